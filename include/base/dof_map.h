@@ -39,6 +39,7 @@
 #include <cstddef>
 #include <iterator>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -543,6 +544,38 @@ public:
    */
   bool all_semilocal_indices (const std::vector<dof_id_type> & dof_indices) const;
 
+  /**
+   * Enables caching of the dof indices of active local elements, so
+   * that repeated calls to \p dof_indices() during assembly copy a
+   * precomputed list instead of walking the \p DofObject buffers of
+   * every node.  The cache is built by \p distribute_dofs(), and so
+   * is refreshed by \p EquationSystems::init() and \p reinit();
+   * it takes effect the next time dofs are distributed.
+   *
+   * At most \p max_bytes of memory are used; elements which do not
+   * fit in the cache have their indices computed on demand as usual.
+   * A size of 0, the default, disables the cache.
+   *
+   * The element maps at the quadrature points can be cached too;
+   * see \p System::set_fe_map_cache_size().
+   */
+  void set_dof_indices_cache_size (std::size_t max_bytes);
+
+  /**
+   * Discards the dof indices cache and, if caching is enabled,
+   * rebuilds it for the active local elements of \p mesh.  \p
+   * distribute_dofs() does this itself; call it after changing the
+   * mesh without redistributing dofs.
+   */
+  void refresh_dof_indices_cache (const MeshBase & mesh);
+
+  /**
+   * \returns the memory limit for the dof indices cache, or 0 if the
+   * cache is disabled.
+   */
+  std::size_t dof_indices_cache_size () const
+  { return _dof_indices_cache_max_bytes; }
+
   /**
    * Allow the implicit_neighbor_dofs flag to be set programmatically.
    * This overrides the --implicit_neighbor_dofs commandline option.
@@ -1239,6 +1272,29 @@ private:
    */
   void add_constraints_to_send_list();
 
+  /**
+   * Sends the constraint rows and constraint values of the dofs in
+   * \p pushed_ids[p] to each processor \p p, communicating only with
+   * the processors involved, and adds each row received for a dof
+   * which isn't already constrained here.  Adjoint constraint values
+   * are sent too if \p push_adjoint_values is true.
+   */
+  void push_dof_constraints (const std::vector<std::set<dof_id_type> > & pushed_ids,
+                             bool push_adjoint_values);
+
+#ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
+  /**
+   * Sends the constraint rows of the nodes with ids in \p
+   * pushed_node_ids[p] to each processor \p p, and adds each row
+   * received for a node which isn't already constrained here.  If \p
+   * push_nodes is true and the mesh is distributed, the constrained
+   * and constraining nodes themselves are sent too.
+   */
+  void push_node_constraints (MeshBase & mesh,
+                              const std::vector<std::set<dof_id_type> > & pushed_node_ids,
+                              bool push_nodes);
+#endif // LIBMESH_ENABLE_NODE_CONSTRAINTS
+
 #endif // LIBMESH_ENABLE_CONSTRAINTS
 
   /**
@@ -1285,6 +1341,56 @@ private:
    */
   std::vector<dof_id_type> _send_list;
 
+  /**
+   * Fills the dof indices cache for the active local elements of
+   * \p mesh, up to the configured memory limit.
+   */
+  void build_dof_indices_cache (const MeshBase & mesh);
+
+  /**
+   * Removes all entries from the dof indices cache.
+   */
+  void clear_dof_indices_cache ();
+
+  /**
+   * \returns true and fills \p di with the cached dof indices for
+   * variable \p vn on \p elem, or for all variables if \p vn is
+   * \p libMesh::invalid_uint.  \returns false if \p elem is not
+   * cached.
+   */
+  bool cached_dof_indices (const Elem * const elem,
+                           std::vector<dof_id_type> & di,
+                           const unsigned int vn) const;
+
+  /**
+   * Memory limit for the dof indices cache.
+   */
+  std::size_t _dof_indices_cache_max_bytes;
+
+  /**
+   * Cache slot for each element id, or \p DofObject::invalid_id.
+   */
+  std::vector<dof_id_type> _dof_indices_cache_slot;
+
+  /**
+   * The element stored in each cache slot, to guard against stale
+   * lookups if the mesh changes before dofs are redistributed.
+   */
+  std::vector<const Elem *> _dof_indices_cache_elem;
+
+  /**
+   * For slot \p s, the indices of variable \p v start at
+   * \p _dof_indices_cache_offsets[s*(n_vars+1)+v] in
+   * \p _dof_indices_cache, and the indices of all variables are the
+   * contiguous range up to \p _dof_indices_cache_offsets[s*(n_vars+1)+n_vars].
+   */
+  std::vector<std::size_t> _dof_indices_cache_offsets;
+
+  /**
+   * The cached dof indices.
+   */
+  std::vector<dof_id_type> _dof_indices_cache;
+
   /**
    * Funtion object to call to add extra entries to the sparsity pattern
    */
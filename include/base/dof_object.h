@@ -29,6 +29,8 @@
 
 // C++ includes
 #include <cstddef>
+#include <cstring> // std::memcpy
+#include <iterator> // std::distance
 #include <vector>
 
 namespace libMesh
@@ -473,7 +475,145 @@ private:
    * (Now of course 0-base everything...  but you get the idea.)
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+
+  /**
+   * Contiguous storage for the DoF index buffer.  This behaves like a
+   * minimal \p std::vector<index_t>, and takes no more space than
+   * one, but small buffers are stored inline in the \p DofObject
+   * itself.  With 64-bit pointers and the default 32-bit indices the
+   * inline capacity is five indices, which holds the buffer for one
+   * system with one or two variable groups, so the common cases need
+   * no heap allocation and no extra indirection.  Only two 64-bit
+   * indices fit inline, so with 64-bit indices most buffers live on
+   * the heap, as they would in a \p std::vector.
+   */
+  class IndexBuffer
+  {
+  public:
+    typedef index_t *       iterator;
+    typedef const index_t * const_iterator;
+
+    /**
+     * As many indices as fit in the space of a \p std::vector, less
+     * our own size word.
+     */
+    static const unsigned int inline_capacity =
+      (3*sizeof(void *) - sizeof(unsigned int)) / sizeof(index_t);
+
+    IndexBuffer () : _size_and_flag(0) {}
+
+    IndexBuffer (const IndexBuffer & other);
+
+    IndexBuffer & operator= (const IndexBuffer & other);
+
+    ~IndexBuffer ()
+    { if (!this->is_inline()) delete [] this->heap_data(); }
+
+    std::size_t size () const { return _size_and_flag & ~heap_flag; }
+
+    bool empty () const { return !this->size(); }
+
+    iterator begin () { return this->data(); }
+    iterator end () { return this->data() + this->size(); }
+    const_iterator begin () const { return this->data(); }
+    const_iterator end () const { return this->data() + this->size(); }
+
+    index_t & operator[] (std::size_t i)
+    { libmesh_assert_less (i, this->size()); return this->data()[i]; }
+
+    const index_t & operator[] (std::size_t i) const
+    { libmesh_assert_less (i, this->size()); return this->data()[i]; }
+
+    /**
+     * Removes all entries, keeping the current storage.
+     */
+    void clear () { this->set_size(0); }
+
+    /**
+     * Removes all entries and frees any heap storage.
+     */
+    void release ();
+
+    void reserve (std::size_t n);
+
+    void resize (std::size_t n, index_t val);
+
+    /**
+     * Replaces the contents with the range [first, last), converting
+     * each entry to \p index_t.
+     */
+    template <typename InputIterator>
+    void assign (InputIterator first, InputIterator last);
+
+    void insert (iterator pos, index_t val);
+
+    void insert (iterator pos, const_iterator first, const_iterator last);
+
+    void erase (iterator first, iterator last);
+
+    /**
+     * Reduces the storage to fit the current size, moving the entries
+     * back inline when they fit.
+     */
+    void shrink_to_fit ();
+
+  private:
+    /**
+     * Set in \p _size_and_flag when the entries live on the heap.
+     */
+    static const unsigned int heap_flag = 1u << (8*sizeof(unsigned int) - 1);
+
+    bool is_inline () const { return !(_size_and_flag & heap_flag); }
+
+    void set_size (std::size_t n)
+    { _size_and_flag = (_size_and_flag & heap_flag) | cast_int<unsigned int>(n); }
+
+    std::size_t capacity () const
+    { return this->is_inline() ? inline_capacity : this->heap_capacity(); }
+
+    /**
+     * Heap storage is described by a pointer and a capacity kept in
+     * the inline storage.  They are copied in and out, rather than
+     * overlaid with a union, so that the pointer's alignment does not
+     * pad the buffer.
+     */
+    index_t * heap_data () const
+    {
+      index_t * ptr;
+      std::memcpy(&ptr, _storage, sizeof(ptr));
+      return ptr;
+    }
+
+    std::size_t heap_capacity () const
+    {
+      unsigned int cap;
+      std::memcpy(&cap, reinterpret_cast<const char *>(_storage) + sizeof(index_t *),
+                  sizeof(cap));
+      return cap;
+    }
+
+    void set_heap (index_t * ptr, std::size_t capacity)
+    {
+      const unsigned int cap = cast_int<unsigned int>(capacity);
+      std::memcpy(_storage, &ptr, sizeof(ptr));
+      std::memcpy(reinterpret_cast<char *>(_storage) + sizeof(index_t *), &cap,
+                  sizeof(cap));
+    }
+
+    index_t * data () { return this->is_inline() ? _storage : this->heap_data(); }
+    const index_t * data () const { return this->is_inline() ? _storage : this->heap_data(); }
+
+    /**
+     * Moves the entries to storage with exactly \p new_capacity slots.
+     */
+    void reallocate (std::size_t new_capacity);
+
+    index_t _storage[inline_capacity];
+
+    unsigned int _size_and_flag;
+  };
+
+  typedef IndexBuffer index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -502,7 +642,10 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
+
+  static std::size_t index_buffer_size ()
+  { return sizeof(index_buffer_t); }
 #endif
 };
 
@@ -510,6 +653,23 @@ public:
 
 //------------------------------------------------------
 // Inline functions
+template <typename InputIterator>
+inline
+void DofObject::IndexBuffer::assign (InputIterator first, InputIterator last)
+{
+  this->clear();
+  const std::size_t n = std::distance(first, last);
+  this->reserve(n);
+
+  index_t * out = this->data();
+  for (; first != last; ++first)
+    *out++ = cast_int<index_t>(*first);
+
+  this->set_size(n);
+}
+
+
+
 inline
 DofObject::DofObject () :
 #ifdef LIBMESH_ENABLE_AMR
@@ -589,8 +749,7 @@ void DofObject::invalidate ()
 inline
 void DofObject::clear_dofs ()
 {
-  // vector swap trick to force deallocation
-  index_buffer_t().swap(_idx_buf);
+  _idx_buf.release();
 
   libmesh_assert_equal_to (this->n_systems(), 0);
   libmesh_assert (_idx_buf.empty());
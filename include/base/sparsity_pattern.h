@@ -25,6 +25,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 #include <vector>
 
 namespace libMesh
@@ -49,7 +50,12 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
 typedef std::vector<dof_id_type, Threads::scalable_allocator<dof_id_type> > Row;
 class Graph : public std::vector<Row> {};
 
-class NonlocalGraph : public std::map<dof_id_type, Row> {};
+/**
+ * Rows of the sparsity pattern owned by other processors, keyed by
+ * global row index and accumulated until \p parallel_sync() sends
+ * them to their owners.  Each row is kept sorted.
+ */
+class NonlocalGraph : public LIBMESH_BEST_UNORDERED_MAP<dof_id_type, Row> {};
 
 /**
  * Splices the two sorted ranges [begin,middle) and [middle,end)
@@ -74,7 +80,9 @@ static void sort_row (const BidirectionalIterator begin,
  * number of nonzeros per row of the matrix is needed for efficient
  * preallocation.  In this case it suffices to provide estimate
  * (but bounding) values, and in this case the threaded method can
- * take some short-cuts for efficiency.
+ * take some short-cuts for efficiency: the full rows are then never
+ * stored, and \p parallel_sync() only sends other processors the
+ * numbers of on- and off-processor entries in their rows.
  */
 class Build : public ParallelObject
 {
@@ -85,6 +93,15 @@ private:
   const bool implicit_neighbor_dofs;
   const bool need_full_sparsity_pattern;
 
+  /**
+   * Calls \p action(row_dofs, col_dofs) for each block of coupled
+   * dofs on the elements in \p range: every dof in \p row_dofs
+   * couples to every dof in \p col_dofs.  Both lists are sorted.
+   */
+  template <typename Action>
+  void visit_coupled_dofs (const ConstElemRange & range,
+                           Action & action) const;
+
 public:
 
   SparsityPattern::Graph sparsity_pattern;
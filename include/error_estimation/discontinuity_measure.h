@@ -26,6 +26,7 @@
 // C++ includes
 #include <cstddef>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace libMesh
@@ -68,6 +69,9 @@ public:
   /**
    * Register a user function to use in computing the essential BCs.
    * The return value is std::pair<bool, Real>
+   *
+   * When libMesh runs with more than one thread, the function is
+   * called from several threads at once, so it must be thread-safe.
    */
   void attach_essential_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                                const Point & p,
@@ -76,8 +80,22 @@ public:
   virtual ErrorEstimatorType type() const libmesh_override
   { return DISCONTINUITY_MEASURE;}
 
+  /**
+   * Returns true for a \p DiscontinuityMeasure itself; derived
+   * classes opt in by overriding both this and \p clone().
+   */
+  virtual bool supports_threading() const libmesh_override
+  { return typeid(*this) == typeid(DiscontinuityMeasure); }
+
 protected:
 
+  /**
+   * Returns a copy of this estimator, so that it may be used on
+   * several threads at once.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const libmesh_override
+  { return UniquePtr<JumpErrorEstimator>(new DiscontinuityMeasure(*this)); }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
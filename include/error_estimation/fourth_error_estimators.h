@@ -26,6 +26,7 @@
 // C++ includes
 #include <vector>
 #include <string>
+#include <typeinfo>
 
 namespace libMesh
 {
@@ -58,8 +59,22 @@ public:
   virtual ErrorEstimatorType type() const libmesh_override
   { return LAPLACIAN;}
 
+  /**
+   * Returns true for a \p LaplacianErrorEstimator itself; derived
+   * classes opt in by overriding both this and \p clone().
+   */
+  virtual bool supports_threading() const libmesh_override
+  { return typeid(*this) == typeid(LaplacianErrorEstimator); }
+
 protected:
 
+  /**
+   * Returns a copy of this estimator, so that it may be used on
+   * several threads at once.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const libmesh_override
+  { return UniquePtr<JumpErrorEstimator>(new LaplacianErrorEstimator(*this)); }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
@@ -23,6 +23,7 @@
 // Local Includes
 #include "libmesh/auto_ptr.h"
 #include "libmesh/dense_vector.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/error_estimator.h"
 #include "libmesh/fem_context.h"
 
@@ -59,7 +60,8 @@ public:
       fine_context(),
       coarse_context(),
       fine_error(0),
-      coarse_error(0) {}
+      coarse_error(0),
+      var(0) {}
 
   /**
    * Destructor.
@@ -88,7 +90,39 @@ public:
    */
   bool scale_by_n_flux_faces;
 
+  /**
+   * Returns true if \p estimate_error() may compute element
+   * contributions on several threads at once, each thread working
+   * with its own \p clone() of this estimator.  The default is false,
+   * in which case \p estimate_error() runs on a single thread.
+   * Derived classes whose side integrations only modify their own
+   * member data may override this (and \p clone()) to return true.
+   */
+  virtual bool supports_threading() const { return false; }
+
 protected:
+  /**
+   * Copy constructor, for use by \p clone() implementations.  Copies
+   * the estimator settings, but not the working contexts.
+   */
+  JumpErrorEstimator(const JumpErrorEstimator & other)
+    : ErrorEstimator(other),
+      scale_by_n_flux_faces(other.scale_by_n_flux_faces),
+      integrate_boundary_sides(other.integrate_boundary_sides),
+      fine_context(),
+      coarse_context(),
+      fine_error(0),
+      coarse_error(0),
+      var(0) {}
+
+  /**
+   * Returns a new estimator with the same settings as this one, to be
+   * used on another thread concurrently with it.  Only called if \p
+   * supports_threading() returns true; the default implementation is
+   * an error.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const;
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -140,6 +174,75 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+
+  /**
+   * A contribution to the (squared) error and the flux face count of
+   * one element.
+   */
+  struct Contribution
+  {
+    Contribution (dof_id_type id, ErrorVectorReal err, float faces) :
+      elem_id(id), error(err), n_flux_faces(faces) {}
+
+    dof_id_type elem_id;
+    ErrorVectorReal error;
+    float n_flux_faces;
+  };
+
+  /**
+   * Builds and initializes \p fine_context and \p coarse_context
+   * for \p system.
+   */
+  void build_contexts (const System & system);
+
+  /**
+   * Computes the jump contributions from the sides of the active
+   * element \p e (and, if \p compute_on_parent, of its parent),
+   * appending them to \p contributions in the order the serial
+   * algorithm would have added them.
+   */
+  void compute_contributions (const System & system,
+                              const Elem * e,
+                              bool compute_on_parent,
+                              std::vector<Contribution> & contributions);
+
+  /**
+   * Class to compute the error contributions for a range of
+   * elements.  May be executed in parallel on separate threads, each
+   * working with its own clone of the estimator.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System & sys,
+                   JumpErrorEstimator & ee,
+                   bool clones,
+                   ConstElemRange::const_iterator first,
+                   const std::vector<bool> & cp,
+                   std::vector<std::vector<Contribution> > & contribs) :
+      system(sys),
+      error_estimator(ee),
+      use_clones(clones),
+      first_elem(first),
+      computes_parent(cp),
+      contributions(contribs)
+    {}
+
+    void operator()(const ConstElemRange & range) const;
+
+  private:
+
+    const System & system;
+    JumpErrorEstimator & error_estimator;
+    const bool use_clones;
+    const ConstElemRange::const_iterator first_elem;
+    const std::vector<bool> & computes_parent;
+    std::vector<std::vector<Contribution> > & contributions;
+  };
+
+  friend class EstimateError;
 };
 
 
@@ -26,6 +26,7 @@
 // C++ includes
 #include <cstddef>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace libMesh
@@ -82,6 +83,12 @@ public:
   /**
    * Register a user function to use in computing the flux BCs.
    * The return value is std::pair<bool, Real>
+   *
+   * When libMesh runs with more than one thread, the function is
+   * called from several threads at once, so it must be thread-safe:
+   * it may read \p system and its own constant data, but any state
+   * it modifies needs its own locking.  Run with --n_threads=1 if
+   * that is not possible.
    */
   void attach_flux_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                           const Point & p,
@@ -90,8 +97,23 @@ public:
   virtual ErrorEstimatorType type() const libmesh_override
   { return KELLY;}
 
+  /**
+   * Returns true for a \p KellyErrorEstimator itself.  Derived classes
+   * do not inherit threading, since \p clone() would slice them; they
+   * opt in by overriding both this and \p clone().
+   */
+  virtual bool supports_threading() const libmesh_override
+  { return typeid(*this) == typeid(KellyErrorEstimator); }
+
 protected:
 
+  /**
+   * Returns a copy of this estimator, so that it may be used on
+   * several threads at once.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const libmesh_override
+  { return UniquePtr<JumpErrorEstimator>(new KellyErrorEstimator(*this)); }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
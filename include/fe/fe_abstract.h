@@ -446,6 +446,12 @@ public:
    */
   const FEMap & get_fe_map() const { return *_fe_map.get(); }
 
+  /**
+   * Makes the mapping object keep the map at the quadrature points
+   * in \p cache, or stop caching if \p cache is \p NULL.
+   */
+  void attach_map_cache (FEMapCache * cache) { _fe_map->attach_cache(cache); }
+
   /**
    * Prints the Jacobian times the weight for each quadrature point.
    */
@@ -0,0 +1,210 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2016 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_BATCH_H
+#define LIBMESH_FE_BATCH_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class QBase;
+
+/**
+ * This class evaluates the element map and the physical shape
+ * function gradients for a batch of up to \p width elements of the
+ * same type at once.
+ *
+ * Per-element data is stored with the element index varying fastest
+ * (an "array of structures of arrays" layout): for example
+ * \p dphi(i,qp,c) returns a pointer to \p width consecutive values,
+ * one per element in the batch.  Loops over the elements of a batch
+ * therefore have a fixed trip count over contiguous memory, which
+ * compilers can vectorize; the kernels in \p reinit() are written
+ * that way too.
+ *
+ * Reference shape function values are identical for every element
+ * and are computed once, in the constructor.  This restricts the
+ * supported finite element families to those whose shape functions
+ * do not depend on element orientation: \p LAGRANGE, \p L2_LAGRANGE
+ * and \p MONOMIAL.  Elements must be mapped with first or second
+ * order Lagrange maps (the default for all Lagrange element types),
+ * and must have the same dimension as the space they live in.
+ */
+class FEBatch
+{
+public:
+
+  /**
+   * The number of elements handled at once.
+   */
+  static const unsigned int width = 8;
+
+  /**
+   * Constructor.  Prepares the reference data for elements of type
+   * \p elem_type, the finite element type \p fe_type and the
+   * quadrature rule \p qrule, which is initialized here for
+   * \p elem_type.
+   */
+  FEBatch (const FEType & fe_type,
+           const ElemType elem_type,
+           QBase & qrule);
+
+  /**
+   * Computes the map, the quadrature weights and the physical shape
+   * function gradients for the \p n_elem elements in \p elems, which
+   * must all have the element type given to the constructor.  At most
+   * \p width elements may be given.  Unused batch entries are filled
+   * with copies of the last element, so whole-batch loops remain
+   * valid; their results should simply be ignored.
+   */
+  void reinit (const Elem * const * elems,
+               const unsigned int n_elem);
+
+  /**
+   * \returns the number of elements in the current batch.
+   */
+  unsigned int n_elem () const { return _n_elem; }
+
+  /**
+   * \returns the number of shape functions per element.
+   */
+  unsigned int n_dofs () const { return _n_dofs; }
+
+  /**
+   * \returns the number of quadrature points per element.
+   */
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * \returns the value of shape function \p i at quadrature point
+   * \p qp, which is the same for every element.
+   */
+  Real phi (const unsigned int i,
+            const unsigned int qp) const
+  { return _phi[i*_n_qp + qp]; }
+
+  /**
+   * \returns the \p width Jacobian times quadrature weight values at
+   * quadrature point \p qp.
+   */
+  const Real * JxW (const unsigned int qp) const
+  { return &_JxW[qp*width]; }
+
+  /**
+   * \returns the \p width values of physical coordinate \p c of
+   * quadrature point \p qp.
+   */
+  const Real * xyz (const unsigned int qp,
+                    const unsigned int c) const
+  { return &_xyz[(qp*LIBMESH_DIM + c)*width]; }
+
+  /**
+   * \returns the \p width values of the derivative with respect to
+   * physical coordinate \p c of shape function \p i at quadrature
+   * point \p qp.
+   */
+  const Real * dphi (const unsigned int i,
+                     const unsigned int qp,
+                     const unsigned int c) const
+  { return &_dphi[((i*_n_qp + qp)*_dim + c)*width]; }
+
+private:
+
+  /**
+   * The element type of every element in a batch.
+   */
+  const ElemType _elem_type;
+
+  /**
+   * The element dimension.
+   */
+  unsigned int _dim;
+
+  /**
+   * The number of map (geometric) shape functions.
+   */
+  unsigned int _n_map;
+
+  /**
+   * The number of shape functions.
+   */
+  unsigned int _n_dofs;
+
+  /**
+   * The number of quadrature points.
+   */
+  unsigned int _n_qp;
+
+  /**
+   * The number of elements in the current batch.
+   */
+  unsigned int _n_elem;
+
+  /**
+   * Quadrature weights.
+   */
+  std::vector<Real> _weights;
+
+  /**
+   * Reference map shape function values, indexed [n*n_qp + qp], and
+   * derivatives, indexed [(n*n_qp + qp)*dim + d].
+   */
+  std::vector<Real> _psi;
+  std::vector<Real> _dpsi;
+
+  /**
+   * Reference shape function values, indexed [i*n_qp + qp], and
+   * derivatives, indexed [(i*n_qp + qp)*dim + d].
+   */
+  std::vector<Real> _phi;
+  std::vector<Real> _dphi_ref;
+
+  /**
+   * Node coordinates of the current batch, indexed
+   * [(n*LIBMESH_DIM + c)*width + e].
+   */
+  std::vector<Real> _node_xyz;
+
+  /**
+   * Batched physical data; see the accessors for the layouts.
+   */
+  std::vector<Real> _JxW;
+  std::vector<Real> _xyz;
+  std::vector<Real> _dphi;
+
+  /**
+   * Inverse Jacobian entries dxi_d/dx_c at the current quadrature
+   * point, indexed [(d*dim + c)*width + e].
+   */
+  std::vector<Real> _dxidx;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_BATCH_H
@@ -32,6 +32,7 @@ namespace libMesh
 
 // forward declarations
 class Elem;
+class FEMapCache;
 class Node;
 
 class FEMap
@@ -93,6 +94,25 @@ public:
                            const Elem * elem,
                            bool calculate_d2phi);
 
+  /**
+   * Same as compute_map, for the points \p qp of a quadrature rule
+   * with weights \p qw.  If a cache has been attached, the map of a
+   * non-affine element is copied from it when it is there, and added
+   * to it otherwise.  Second derivatives are never cached.
+   */
+  void compute_quadrature_map(const unsigned int dim,
+                              const std::vector<Point> & qp,
+                              const std::vector<Real> & qw,
+                              const Elem * elem,
+                              bool calculate_d2phi);
+
+  /**
+   * Makes \p compute_quadrature_map() use \p cache, or no cache if
+   * \p cache is \p NULL.
+   */
+  void attach_cache(FEMapCache * cache)
+  { _cache = cache; }
+
   /**
    * Same as compute_map, but for a side.  Useful for boundary integration.
    */
@@ -879,6 +899,11 @@ protected:
   friend class FE;
 
 private:
+  /**
+   * The cache used by compute_quadrature_map(), if any.
+   */
+  FEMapCache * _cache;
+
   /**
    * A helper function used by FEMap::compute_single_point_map() to
    * compute second derivatives of the inverse map.
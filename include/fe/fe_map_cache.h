@@ -0,0 +1,155 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2016 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_MAP_CACHE_H
+#define LIBMESH_FE_MAP_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/point.h"
+#include "libmesh/threads.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+
+/**
+ * This class keeps the mapping data an \p FEMap computes for
+ * non-affine elements at the points of a quadrature rule, so that
+ * repeated reinitializations on a mesh which does not move, such as
+ * those of every Newton step of a transient solve, copy the data
+ * instead of computing it again.  An \p FEMap uses a cache once it
+ * has been given one with \p FEMap::attach_cache().
+ *
+ * Entries are added as elements are first reinitialized, one per
+ * element, until the memory limit is reached.  An entry is only used
+ * for the same element, the same node positions and the same
+ * quadrature points and weights it was computed for, but the cache
+ * should still be cleared whenever the mesh changes, to free the
+ * stale entries.  Entries may be looked up and added from several
+ * threads at once.
+ */
+class FEMapCache
+{
+public:
+
+  /**
+   * The mapping data of one element at the points of one quadrature
+   * rule, along with what it was computed from.
+   */
+  struct Entry
+  {
+    const Elem * elem;
+    std::vector<Point> nodes;
+    std::vector<Point> qp;
+    std::vector<Real> qw;
+
+    bool has_xyz;
+    bool has_dxyz;
+
+    std::vector<Point> xyz;
+    std::vector<RealGradient> dxyzdxi, dxyzdeta, dxyzdzeta;
+    std::vector<Real> dxidx, dxidy, dxidz;
+    std::vector<Real> detadx, detady, detadz;
+    std::vector<Real> dzetadx, dzetady, dzetadz;
+    std::vector<Real> jac, JxW;
+
+    /**
+     * \returns the memory used by the entry.
+     */
+    std::size_t bytes () const;
+  };
+
+  /**
+   * Constructor.  The cache is disabled until it is given a memory
+   * limit.
+   */
+  FEMapCache ();
+
+  /**
+   * Destructor.
+   */
+  ~FEMapCache ();
+
+  /**
+   * Sets the memory limit of the cache to \p max_bytes, discarding
+   * any entries.  A limit of 0 disables the cache.
+   */
+  void set_max_bytes (std::size_t max_bytes);
+
+  /**
+   * \returns the memory limit of the cache, or 0 if it is disabled.
+   */
+  std::size_t max_bytes () const
+  { return _max_bytes; }
+
+  /**
+   * Discards every entry.  This must not be called while other
+   * threads use the cache.
+   */
+  void clear ();
+
+  /**
+   * \returns the entry of \p elem if it was computed from its current
+   * node positions at the quadrature points \p qp with weights \p qw,
+   * or \p NULL otherwise.
+   */
+  const Entry * find (const Elem & elem,
+                      const std::vector<Point> & qp,
+                      const std::vector<Real> & qw) const;
+
+  /**
+   * \returns \p true if no more entries fit in the cache.
+   */
+  bool full () const;
+
+  /**
+   * Takes the contents of \p entry as the entry of its element,
+   * leaving \p entry empty, unless the element already has an entry
+   * or the entry does not fit in the cache.
+   */
+  void add (Entry & entry);
+
+private:
+
+  /**
+   * The memory limit, and the memory used so far.
+   */
+  std::size_t _max_bytes;
+  std::size_t _bytes_used;
+
+  /**
+   * The entries, indexed by element id.  Entries are never changed
+   * once they are added, so only finding and adding them needs the
+   * lock.
+   */
+  std::vector<Entry *> _entries;
+
+  mutable Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_MAP_CACHE_H
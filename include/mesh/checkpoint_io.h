@@ -100,6 +100,17 @@ public:
   bool & binary()       { return _binary; }
 
 
+  /**
+   * Get/Set the flag indicating if we should write the memory-mapped
+   * binary layout: aligned little-endian arrays behind a header of
+   * section offsets, which \p read() walks in place without decoding
+   * individual values.  Files in this layout are recognized on read
+   * regardless of this flag, and can only be read by builds with
+   * the same size of \p Real.
+   */
+  bool   mapped() const { return _mapped; }
+  bool & mapped()       { return _mapped; }
+
   /**
    * Get/Set the version string.
    */
@@ -139,6 +150,11 @@ private:
    */
   void write_bc_names (Xdr & io, const BoundaryInfo & info, bool is_sideset) const;
 
+  /**
+   * Write the whole mesh to \p file_name in the memory-mapped layout
+   */
+  void write_mapped (const std::string & file_name) const;
+
 
   //---------------------------------------------------------------------------
   // Read Implementation
@@ -172,6 +188,11 @@ private:
    */
   void read_bc_names(Xdr & io, BoundaryInfo & info, bool is_sideset);
 
+  /**
+   * Read the whole mesh from \p file_name in the memory-mapped layout
+   */
+  void read_mapped (const std::string & file_name);
+
   /**
    * Return the number of levels of refinement in the active mesh on this processor.
    * NOTE: This includes _all_ elements on this processor even those not owned by this processor!
@@ -181,6 +202,7 @@ private:
   unsigned int n_active_levels_on_processor(const MeshBase & mesh) const;
 
   bool _binary;
+  bool _mapped;
   std::string _version;
 };
 
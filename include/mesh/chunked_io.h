@@ -0,0 +1,119 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2016 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CHUNKED_IO_H
+#define LIBMESH_CHUNKED_IO_H
+
+
+// Local includes
+#include "libmesh/libmesh.h"
+#include "libmesh/mesh_input.h"
+#include "libmesh/mesh_output.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The ChunkedIO class reads and writes meshes in a binary format
+ * which no processor has to hold in full.  Each processor packs the
+ * elements it owns, together with their ancestors and nodes, into a
+ * self-contained chunk, and writes it to a single shared file at an
+ * offset computed by a prefix scan of the chunk sizes.  Processor 0
+ * only writes a small header and the table of chunk offsets.  With
+ * MPI the chunks are written and read with collective MPI-IO calls.
+ *
+ * A file written on N processors can be read on any number of
+ * processors: each reader takes a contiguous range of the chunks, and
+ * elements are assigned to the processor which read them.  A
+ * \p ReplicatedMesh gathers every chunk instead.  Unlike
+ * \p CheckpointIO, no processor ever reads a chunk it will not keep.
+ *
+ * Files are written in the byte order of the writer; readers swap
+ * bytes if necessary.
+ */
+class ChunkedIO : public MeshInput<MeshBase>,
+                  public MeshOutput<MeshBase>,
+                  public ParallelObject
+{
+public:
+  // The size used for every entry in the file
+  typedef uint64_t chunk_word_type;
+
+  /**
+   * Constructor.  Takes a writeable reference to a mesh object.
+   * This is the constructor required to read a mesh.
+   */
+  explicit
+  ChunkedIO (MeshBase &);
+
+  /**
+   * Constructor.  Takes a reference to a constant mesh object.
+   * This constructor will only allow us to write the mesh.
+   */
+  explicit
+  ChunkedIO (const MeshBase &);
+
+  /**
+   * Destructor.
+   */
+  virtual ~ChunkedIO ();
+
+  /**
+   * This method implements reading a mesh from a specified file.
+   */
+  virtual void read (const std::string &) libmesh_override;
+
+  /**
+   * This method implements writing a mesh to a specified file.
+   */
+  virtual void write (const std::string &) libmesh_override;
+
+private:
+  /**
+   * Packs the elements and nodes this processor writes into \p chunk.
+   */
+  void pack_chunk (std::vector<chunk_word_type> & chunk) const;
+
+  /**
+   * Packs the subdomain, sideset and nodeset names into \p names.
+   */
+  void pack_names (std::vector<chunk_word_type> & names) const;
+
+  /**
+   * Adds the nodes and elements in \p chunk to the mesh, skipping
+   * any we already have.  Processor ids are translated through \p
+   * new_pid, which is indexed by the processor id in the file.
+   */
+  void unpack_chunk (const chunk_word_type * chunk,
+                     const std::vector<processor_id_type> & new_pid);
+
+  /**
+   * Sets the subdomain, sideset and nodeset names from \p names.
+   */
+  void unpack_names (const chunk_word_type * names);
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_CHUNKED_IO_H
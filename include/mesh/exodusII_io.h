@@ -28,6 +28,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <map>
 
 namespace libMesh
 {
@@ -37,6 +38,7 @@ class EquationSystems;
 class ExodusII_IO_Helper;
 class MeshBase;
 class System;
+template <typename T> class NumericVector;
 
 /**
  * The \p ExodusII_IO class implements reading meshes in the
@@ -150,6 +152,31 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) libmesh_override;
 
+  /**
+   * Write out a nodal solution from a parallel vector.  A serialized
+   * mesh is written by processor 0 alone, so only processor 0 gathers
+   * the solution.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) libmesh_override;
+
+  /**
+   * Write out the nodal solution at the nodes each processor owns, as
+   * built by EquationSystems::build_local_nodal_solution().  Only for
+   * distributed meshes.
+   */
+  virtual void write_local_nodal_data (const std::string &,
+                                       const std::vector<dof_id_type> &,
+                                       const std::vector<Number> &,
+                                       const std::vector<std::string> &) libmesh_override;
+
+  /**
+   * \returns \p true if the mesh is distributed, and so is written by
+   * every processor in turn.
+   */
+  virtual bool can_write_local_nodal_data () const libmesh_override;
+
   /**
    * Write out a discontinuous nodal solution.
    */
@@ -279,6 +306,24 @@ private:
                                const std::vector<std::string> & names,
                                bool continuous=true);
 
+  /**
+   * Writes the values \p local_soln, ordered by variable within node
+   * for the nodes this processor owns, of a distributed mesh.
+   */
+  void write_distributed_nodal_data(const std::vector<Number> & local_soln,
+                                    const std::vector<std::string> & names,
+                                    const std::vector<std::string> & output_names);
+
+  /**
+   * Collects the names of the CONSTANT MONOMIAL variables of \p es,
+   * only those in \p filter_names if it is not empty, and the values
+   * of those variables on each active local element.
+   */
+  void build_local_element_values(const EquationSystems & es,
+                                  const std::vector<std::string> & filter_names,
+                                  std::vector<std::string> & names,
+                                  std::map<dof_id_type, std::vector<Real> > & local_values) const;
+
   /**
    * If true, _output_variables is allowed to remain empty.
    * If false, if _output_variables is empty it will be populated with a complete list of all variables
@@ -73,6 +73,7 @@ namespace libMesh
 
 // Forward declarations
 class MeshBase;
+class Elem;
 
 /**
  * This is the \p ExodusII_IO_Helper class.  This class hides the
@@ -321,6 +322,36 @@ public:
    */
   void write_nodal_values(int var_id, const std::vector<Real> & values, int timestep);
 
+  /**
+   * Writes the nodes, active elements, sidesets and nodesets of a
+   * distributed \p mesh without gathering it.  Each processor numbers
+   * the nodes and elements it owns after those of lower ranked
+   * processors, keeping element blocks contiguous, and packs them.
+   * Processor 0 receives and writes one processor's part at a time
+   * with the partial-write ExodusII calls, so no processor ever holds
+   * more than its own part and one other.  Must be called on every
+   * processor, after create().
+   */
+  void write_distributed_mesh(std::string str_title, const MeshBase & mesh);
+
+  /**
+   * Writes nodal variable \p var_id of a file written by
+   * write_distributed_mesh().  \p local_values holds the values at the
+   * nodes this processor owns, in local node iterator order.  Must be
+   * called on every processor.
+   */
+  void write_distributed_nodal_values(int var_id, const std::vector<Real> & local_values, int timestep);
+
+  /**
+   * Writes element variables to a file written by
+   * write_distributed_mesh().  \p local_values holds, for the id of
+   * each active local element, its value of every element variable.
+   * Must be called on every processor.
+   */
+  void write_distributed_element_values(const MeshBase & mesh,
+                                        const std::map<dof_id_type, std::vector<Real> > & local_values,
+                                        int timestep);
+
   /**
    * Writes the vector of information records.
    */
@@ -602,6 +633,17 @@ protected:
 
 private:
 
+  /**
+   * Groups the active elements this processor owns by subdomain for
+   * the distributed writers, setting \p block_ids to the blocks of
+   * every processor.  \p local_blocks[b] holds our elements of block
+   * b, and \p block_counts[p*num_elem_blk+b] the number of elements
+   * processor p has in it.
+   */
+  void distributed_blocks(const MeshBase & mesh,
+                          std::vector<std::vector<const Elem *> > & local_blocks,
+                          std::vector<dof_id_type> & block_counts);
+
   /**
    * Wraps calls to exII::ex_put_var_names() and exII::ex_put_var_param().
    * The enumeration controls whether nodal, elemental, or global
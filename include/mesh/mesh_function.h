@@ -176,6 +176,21 @@ public:
                    DenseVector<Number> & output,
                    const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Computes values at each of the coordinates \p points and for time
+   * \p time, optionally restricting the points to the passed
+   * subdomain_ids.  The points are located all at once, with
+   * \p PointLocatorBase::locate(), which is much faster than locating
+   * them one by one when there are many of them.  For a variable which
+   * is discontinuous between elements, the value at a point on a
+   * shared face may come from a different element than the
+   * single-point \p operator() would use.
+   */
+  void operator() (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<DenseVector<Number> > & output,
+                   const std::set<subdomain_id_type> * subdomain_ids = libmesh_nullptr);
+
   /**
    * Similar to operator() with the same parameter list, but with the difference
    * that multiple values on faces are explicitly permitted. This is useful for
@@ -293,6 +308,22 @@ protected:
   const Elem * find_element(const Point & p,
                             const std::set<subdomain_id_type> * subdomain_ids = libmesh_nullptr) const;
 
+  /**
+   * If \p element, which contains \p p, is not local and our vector is
+   * not serial, \returns a local element sharing the point instead
+   * (or \p NULL if there is none); otherwise returns \p element.
+   */
+  const Elem * local_element_for(const Point & p,
+                                 const Elem * element) const;
+
+  /**
+   * Interpolates our variables at the point \p p, which lies in
+   * \p element, into \p output.
+   */
+  void interpolate(const Elem * element,
+                   const Point & p,
+                   DenseVector<Number> & output) const;
+
   /**
    * Similar to find_element but returns all elements that are close to a point
    * to cover cases where p is on the boundary
@@ -115,6 +115,30 @@ public:
                                  const NumericVector<Number> &,
                                  const std::vector<std::string> &);
 
+  /**
+   * This method should be overridden by "parallel" output formats
+   * which can write the nodal data of each processor's own nodes
+   * directly, without any vector over all the nodes of the mesh.
+   * Each processor passes the ids of the nodes it owns and their
+   * values, in node-major order, as built by
+   * EquationSystems::build_local_nodal_solution().
+   *
+   * write_equation_systems() only uses it when
+   * can_write_local_nodal_data() returns true.
+   */
+  virtual void write_local_nodal_data (const std::string &,
+                                       const std::vector<dof_id_type> &,
+                                       const std::vector<Number> &,
+                                       const std::vector<std::string> &)
+  { libmesh_not_implemented(); }
+
+  /**
+   * \returns \p true if this object can write the nodal data of its
+   * mesh with write_local_nodal_data().  False by default.
+   */
+  virtual bool can_write_local_nodal_data () const
+  { return false; }
+
   /**
    * Return/set the precision to use when writing ASCII files.
    *
@@ -31,6 +31,7 @@
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/topology_map.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
 
 // C++ Includes   -----------------------------------
 #include <vector>
@@ -40,7 +41,6 @@ namespace libMesh
 
 // Forward Declarations -----------------------------
 class MeshBase;
-class Point;
 class Node;
 class ErrorVector;
 class PeriodicBoundaries;
@@ -483,6 +483,12 @@ public:
    */
   bool & enforce_mismatch_limit_prior_to_refinement();
 
+  /**
+   * Get/set the _frontier_sweeps flag.  The default value for this
+   * flag is true.
+   */
+  bool & frontier_sweeps();
+
 private:
 
   /**
@@ -710,11 +716,64 @@ private:
                                  const PointLocatorBase * point_locator,
                                  const Elem * neighbor);
 
+  /**
+   * Fills \p elems with all the active elements of the mesh.
+   */
+  void all_active_elements (std::vector<Elem *> & elems);
+
+  /**
+   * Appends to \p frontier the active elements whose compatibility
+   * checks look at the flags of \p elem: its active neighbors, and
+   * the active children of its refined neighbors.
+   */
+  void add_frontier_neighbors (Elem * elem,
+                               const PointLocatorBase * point_locator,
+                               std::vector<Elem *> & frontier);
+
+  /**
+   * Where a node of a child of an element being refined comes from:
+   * a parent \p node, or else the node between any pair of \p
+   * bracketing_nodes, which is created at \p point unless it exists
+   * already.
+   */
+  struct ChildNode
+  {
+    ChildNode () : node(libmesh_nullptr) {}
+
+    Node * node;
+    Point point;
+    std::vector<std::pair<dof_id_type, dof_id_type> > bracketing_nodes;
+  };
+
+  /**
+   * Threaded functor which fills in the \p ChildNode records of the
+   * elements about to be refined, from per-type tables gathered
+   * beforehand, without taking any locks.
+   */
+  class FindChildNodes;
+
+  /**
+   * Fills in \p child_node for node \p node of child \p child of \p
+   * parent, for the parents \p _refine_elements() has no records
+   * for.
+   */
+  void find_child_node (Elem & parent,
+                        unsigned int child,
+                        unsigned int node,
+                        ChildNode & child_node) const;
+
   /**
    * Data structure that holds the new nodes information.
    */
   TopologyMap _new_nodes_map;
 
+  /**
+   * The \p ChildNode records of all the children of the element
+   * currently being refined, indexed by child*n_nodes()+node, or
+   * \p NULL if \p add_node() has to work them out itself.
+   */
+  const ChildNode * _child_nodes;
+
   /**
    * Reference to the mesh.
    */
@@ -822,6 +881,18 @@ private:
    */
   bool _enforce_mismatch_limit_prior_to_refinement;
 
+  /**
+   * If \p _frontier_sweeps is true, make_refinement_compatible() and
+   * make_coarsening_compatible() look at every active element in
+   * their first sweep, and afterwards only at the elements next to
+   * those whose flags just changed.  If false, every sweep looks at
+   * every active element again.  Both give the same flags; the full
+   * rescans are much slower, and mostly useful for testing.
+   *
+   * Default value is true.
+   */
+  bool _frontier_sweeps;
+
   /**
    * This helper function enforces the desired mismatch limits prior
    * to refinement.  It is called from the
@@ -929,6 +1000,11 @@ inline bool & MeshRefinement::enforce_mismatch_limit_prior_to_refinement()
   return _enforce_mismatch_limit_prior_to_refinement;
 }
 
+inline bool & MeshRefinement::frontier_sweeps()
+{
+  return _frontier_sweeps;
+}
+
 
 
 } // namespace libMesh
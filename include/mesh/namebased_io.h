@@ -127,7 +127,8 @@ NameBasedIO::is_parallel_file_format (const std::string & name)
           (name.rfind(".xdr") < name.size()) ||
           (name.rfind(".nem") < name.size()) ||
           (name.rfind(".n") < name.size())   ||
-          (name.rfind(".cp") < name.size())
+          (name.rfind(".cp") < name.size())  ||
+          (name.rfind(".cmsh") < name.size())
           );
 }
 
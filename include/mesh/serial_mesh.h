@@ -26,6 +26,7 @@
 
 // C++ Includes   -----------------------------------
 #include <cstddef>
+#include <utility> // std::pair
 
 namespace libMesh
 {
@@ -95,6 +96,27 @@ public:
    */
   virtual void renumber_nodes_and_elements () libmesh_override;
 
+  /**
+   * Enables or disables arena storage for nodes created by
+   * \p add_point().  When enabled, nodes are constructed in large
+   * contiguous blocks rather than with one heap allocation each,
+   * which reduces allocator overhead and keeps nodes that were
+   * created together close together in memory.  Slots of deleted
+   * nodes are recycled.  Nodes passed in through \p add_node() or
+   * \p insert_node() are still owned individually.
+   *
+   * This may be changed at any time; it only affects nodes created
+   * afterwards.  Defaults to false.
+   */
+  void use_node_arena (bool use_arena)
+  { _use_node_arena = use_arena; }
+
+  /**
+   * \returns true if new nodes are allocated from the node arena.
+   */
+  bool using_node_arena () const
+  { return _use_node_arena; }
+
   virtual dof_id_type n_nodes () const libmesh_override
   { return cast_int<dof_id_type>(_nodes.size()); }
 
@@ -104,8 +126,7 @@ public:
   virtual dof_id_type max_node_id () const libmesh_override
   { return cast_int<dof_id_type>(_nodes.size()); }
 
-  virtual void reserve_nodes (const dof_id_type nn) libmesh_override
-  { _nodes.reserve (nn); }
+  virtual void reserve_nodes (const dof_id_type nn) libmesh_override;
 
   virtual dof_id_type n_elem () const libmesh_override
   { return cast_int<dof_id_type>(_elements.size()); }
@@ -401,6 +422,54 @@ protected:
 
 private:
 
+  /**
+   * Builds a new node, from the node arena if it is enabled.
+   */
+  Node * build_node (const Point & p, const dof_id_type id);
+
+  /**
+   * Destroys a node and releases its memory, either back to the node
+   * arena or to the heap.
+   */
+  void free_node (Node * n);
+
+  /**
+   * \returns true if \p n lives in one of the node arena blocks.
+   */
+  bool node_arena_owns (const Node * n) const;
+
+  /**
+   * Releases the node arena blocks.  All arena nodes must already
+   * have been freed.
+   */
+  void clear_node_arena ();
+
+  /**
+   * Whether new nodes are built in the node arena.
+   */
+  bool _use_node_arena;
+
+  /**
+   * Raw storage blocks of the node arena, with the capacity (in
+   * nodes) of each block.
+   */
+  std::vector<std::pair<char *, std::size_t> > _node_blocks;
+
+  /**
+   * Number of slots handed out from the most recent block.
+   */
+  std::size_t _node_block_used;
+
+  /**
+   * Requested size of the next block, as set by \p reserve_nodes().
+   */
+  std::size_t _node_block_hint;
+
+  /**
+   * Arena slots whose nodes have been deleted and may be reused.
+   */
+  std::vector<void *> _free_node_slots;
+
   /**
    * Helper function for stitch_meshes and stitch_surfaces
    * that does the mesh stitching.
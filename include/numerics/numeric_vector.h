@@ -561,6 +561,29 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const = 0;
 
+  /**
+   * Starts the same update of \p v_local as \p localize(v_local,
+   * send_list), without waiting for the values owned by other
+   * processors.  When this returns the entries of \p v_local owned by
+   * this processor are already up to date, so work which only reads
+   * them can proceed while the rest are in flight; \p
+   * end_ghost_update() must be called before reading the others.
+   * Neither vector may be modified in between, and only one update
+   * per source vector may be in progress at a time.
+   *
+   * The default implementation simply calls \p localize(), so that
+   * backends without nonblocking communication complete the whole
+   * update here.
+   */
+  virtual void begin_ghost_update (NumericVector<T> & v_local,
+                                   const std::vector<numeric_index_type> & send_list) const;
+
+  /**
+   * Completes the update of \p v_local started by \p
+   * begin_ghost_update().
+   */
+  virtual void end_ghost_update (NumericVector<T> & v_local) const;
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".  Note that indices can be different on every
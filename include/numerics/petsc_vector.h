@@ -471,6 +471,19 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const libmesh_override;
 
+  /**
+   * Starts a \p VecScatter (or, into a ghosted vector, a ghost
+   * update) for the values of \p v_local owned by other processors.
+   * See numeric_vector.h for more details.
+   */
+  virtual void begin_ghost_update (NumericVector<T> & v_local,
+                                   const std::vector<numeric_index_type> & send_list) const libmesh_override;
+
+  /**
+   * Completes the update started by \p begin_ghost_update().
+   */
+  virtual void end_ghost_update (NumericVector<T> & v_local) const libmesh_override;
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".  See numeric_vector.h for more details.
@@ -648,6 +661,18 @@ private:
    * Whether or not the data array is for read only access
    */
   mutable bool _values_read_only;
+
+  /**
+   * The vector being updated by a \p begin_ghost_update() which has
+   * not been ended yet, or \p NULL.
+   */
+  mutable PetscVector<T> * _ghost_update_target;
+
+  /**
+   * The scatter in flight to \p _ghost_update_target, unless that is
+   * a ghosted vector updating its own ghost values.
+   */
+  mutable VecScatter _ghost_scatter;
 };
 
 
@@ -667,7 +692,9 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in, const Paral
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _ghost_update_target(libmesh_nullptr),
+  _ghost_scatter(libmesh_nullptr)
 {
   this->_type = ptype;
 }
@@ -686,7 +713,9 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in,
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _ghost_update_target(libmesh_nullptr),
+  _ghost_scatter(libmesh_nullptr)
 {
   this->init(n, n, false, ptype);
 }
@@ -706,7 +735,9 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in,
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _ghost_update_target(libmesh_nullptr),
+  _ghost_scatter(libmesh_nullptr)
 {
   this->init(n, n_local, false, ptype);
 }
@@ -727,7 +758,9 @@ PetscVector<T>::PetscVector (const Parallel::Communicator & comm_in,
   _global_to_local_map(),
   _destroy_vec_on_exit(true),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _ghost_update_target(libmesh_nullptr),
+  _ghost_scatter(libmesh_nullptr)
 {
   this->init(n, n_local, ghost, false, ptype);
 }
@@ -747,7 +780,9 @@ PetscVector<T>::PetscVector (Vec v,
   _global_to_local_map(),
   _destroy_vec_on_exit(false),
   _values_manually_retrieved(false),
-  _values_read_only(false)
+  _values_read_only(false),
+  _ghost_update_target(libmesh_nullptr),
+  _ghost_scatter(libmesh_nullptr)
 {
   this->_vec = v;
   this->_is_closed = true;
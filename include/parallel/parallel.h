@@ -701,6 +701,10 @@ private:
   mutable std::map<int, unsigned int> used_tag_values;
   bool          _I_duped_it;
 
+  // Number of sparse_exchange() calls so far, used to alternate
+  // message tags between consecutive exchanges
+  mutable unsigned int _n_sparse_exchanges;
+
   // Communication operations:
 public:
 
@@ -719,6 +723,33 @@ public:
    */
   void barrier () const;
 
+  /**
+   * Sends \p data_to_send[p] to each processor \p p, and fills
+   * \p data_received[q] with whatever each processor \p q sent to
+   * this one.  Empty vectors are not sent, so processors which
+   * receive nothing from \p q get no entry for it.  \p T may be
+   * any type with a \p StandardType, or a \p std::vector of such.
+   *
+   * Each processor only communicates with the processors it actually
+   * exchanges data with.  Completion is detected with a
+   * nonblocking barrier once all of this processor's synchronous
+   * sends have been matched (the "NBX" algorithm of Hoefler, Siebert
+   * and Lumsdaine), so no rounds over all processors are needed.
+   * Without MPI-3, the number of incoming messages is found with a
+   * global sum instead.
+   */
+  template <typename T>
+  void sparse_exchange (const std::map<unsigned int, std::vector<T> > & data_to_send,
+                        std::map<unsigned int, std::vector<T> > & data_received) const;
+
+  /**
+   * Sends the packed buffers in \p send_buffers and receives those
+   * sent to this processor, as in \p sparse_exchange().  The
+   * contents of \p send_buffers may be swapped out.
+   */
+  void sparse_exchange_packed (std::map<unsigned int, std::vector<char> > & send_buffers,
+                               std::map<unsigned int, std::vector<char> > & recv_buffers) const;
+
   /**
    * Verify that a local variable has the same value on all processors.
    * Containers must have the same value in every entry.
@@ -28,6 +28,7 @@
 #include "libmesh/parallel.h"
 
 // C++ Includes   -----------------------------------
+#include <map>
 #include LIBMESH_INCLUDE_UNORDERED_SET
 
 
@@ -132,6 +133,38 @@ void sync_node_data_by_element_id(MeshBase & mesh,
 //------------------------------------------------------------------------
 // Parallel members
 
+// Serve the requests_to_fill we have received, each already
+// translated into our local ids, with the user's data, and hand the
+// answers to our own requests, for objects requested_objs_id, back to
+// the user.
+template <typename SyncFunctor>
+void sync_requested_data(const Communicator & comm,
+                         const std::map<unsigned int, std::vector<dof_id_type> > & request_to_fill_id,
+                         const std::map<unsigned int, std::vector<dof_id_type> > & requested_objs_id,
+                         SyncFunctor & sync)
+{
+  // Gather whatever data the user wants
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> > data;
+  for (std::map<unsigned int, std::vector<dof_id_type> >::const_iterator
+         it = request_to_fill_id.begin(); it != request_to_fill_id.end(); ++it)
+    sync.gather_data(it->second, data[it->first]);
+
+  // Trade back the results
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> > received_data;
+  comm.sparse_exchange(data, received_data);
+
+  // Let the user process the results
+  for (std::map<unsigned int, std::vector<dof_id_type> >::const_iterator
+         it = requested_objs_id.begin(); it != requested_objs_id.end(); ++it)
+    {
+      std::vector<typename SyncFunctor::datum> & received =
+        received_data[it->first];
+      libmesh_assert_equal_to (it->second.size(), received.size());
+
+      sync.act_on_data(it->second, received);
+    }
+}
+
 template <typename Iterator,
           typename DofObjType,
           typename SyncFunctor>
@@ -151,81 +184,46 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
   libmesh_assert(!need_map_update);
 #endif
 
-  // Count the objectss to ask each processor about
-  std::vector<dof_id_type>
-    ghost_objects_from_proc(comm.size(), 0);
+  // Request sets to send to each processor, with the x, y and z
+  // coordinates of each object interleaved
+  std::map<unsigned int, std::vector<Real> > requested_objs_xyz;
+  // Corresponding ids to keep track of
+  std::map<unsigned int, std::vector<dof_id_type> > requested_objs_id;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       DofObjType * obj = *it;
       libmesh_assert (obj);
       processor_id_type obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<Real> >
-    requested_objs_x(comm.size()),
-    requested_objs_y(comm.size()),
-    requested_objs_z(comm.size());
-  // Corresponding ids to keep track of
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_id(comm.size());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (processor_id_type p=0; p != comm.size(); ++p)
-    if (p != comm.rank())
-      {
-        requested_objs_x[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_y[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_z[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-      }
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObjType * obj = *it;
-      processor_id_type obj_procid = obj->processor_id();
       if (obj_procid == comm.rank() ||
           obj_procid == DofObject::invalid_processor_id)
         continue;
 
       Point p = location_map.point_of(*obj);
-      requested_objs_x[obj_procid].push_back(p(0));
-      requested_objs_y[obj_procid].push_back(p(1));
-      requested_objs_z[obj_procid].push_back(p(2));
+      std::vector<Real> & xyz = requested_objs_xyz[obj_procid];
+      xyz.push_back(p(0));
+      xyz.push_back(p(1));
+      xyz.push_back(p(2));
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
-  // Trade requests with other processors
-  for (processor_id_type p=1; p != comm.size(); ++p)
+  // Trade requests with only those processors we need to talk to
+  std::map<unsigned int, std::vector<Real> > request_to_fill_xyz;
+  comm.sparse_exchange(requested_objs_xyz, request_to_fill_xyz);
+
+  // Find the local id of each requested object
+  std::map<unsigned int, std::vector<dof_id_type> > request_to_fill_id;
+  for (std::map<unsigned int, std::vector<Real> >::const_iterator
+         it = request_to_fill_xyz.begin(); it != request_to_fill_xyz.end(); ++it)
     {
-      // Trade my requests with processor procup and procdown
-      const processor_id_type procup =
-        cast_int<processor_id_type>
-        ((comm.rank() + p) % comm.size());
-      const processor_id_type procdown =
-        cast_int<processor_id_type>
-        ((comm.size() + comm.rank() - p) %
-         comm.size());
-      std::vector<Real> request_to_fill_x,
-        request_to_fill_y,
-        request_to_fill_z;
-      comm.send_receive(procup, requested_objs_x[procup],
-                        procdown, request_to_fill_x);
-      comm.send_receive(procup, requested_objs_y[procup],
-                        procdown, request_to_fill_y);
-      comm.send_receive(procup, requested_objs_z[procup],
-                        procdown, request_to_fill_z);
-
-      // Find the local id of each requested object
-      std::vector<dof_id_type> request_to_fill_id(request_to_fill_x.size());
-      for (std::size_t i=0; i != request_to_fill_x.size(); ++i)
+      const std::vector<Real> & xyz = it->second;
+      libmesh_assert_equal_to (xyz.size() % 3, 0);
+
+      std::vector<dof_id_type> & ids = request_to_fill_id[it->first];
+      ids.resize(xyz.size() / 3);
+      for (std::size_t i=0; i != ids.size(); ++i)
         {
-          Point pt(request_to_fill_x[i],
-                   request_to_fill_y[i],
-                   request_to_fill_z[i]);
+          Point pt(xyz[3*i], xyz[3*i+1], xyz[3*i+2]);
 
           // Look for this object in the multimap
           DofObjType * obj = location_map.find(pt);
@@ -235,23 +233,11 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
 
           // Return the object's correct processor id,
           // and our (correct if it's local) id for it.
-          request_to_fill_id[i] = obj->id();
+          ids[i] = obj->id();
         }
-
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
-      libmesh_assert_equal_to (requested_objs_x[procup].size(),
-                               received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
     }
+
+  sync_requested_data(comm, request_to_fill_id, requested_objs_id, sync);
 }
 
 
@@ -266,34 +252,14 @@ void sync_dofobject_data_by_id(const Communicator & comm,
   // This function must be run on all processors at once
   libmesh_parallel_only(comm);
 
-  // Count the objects to ask each processor about
-  std::vector<dof_id_type>
-    ghost_objects_from_proc(comm.size(), 0);
+  // Request sets to send to each processor
+  std::map<unsigned int, std::vector<dof_id_type> > requested_objs_id;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       DofObject * obj = *it;
       libmesh_assert (obj);
       processor_id_type obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_id(comm.size());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (processor_id_type p=0; p != comm.size(); ++p)
-    if (p != comm.rank())
-      {
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-      }
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObject * obj = *it;
-      processor_id_type obj_procid = obj->processor_id();
       if (obj_procid == comm.rank() ||
           obj_procid == DofObject::invalid_processor_id)
         continue;
@@ -301,35 +267,11 @@ void sync_dofobject_data_by_id(const Communicator & comm,
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
-  // Trade requests with other processors
-  for (processor_id_type p=1; p != comm.size(); ++p)
-    {
-      // Trade my requests with processor procup and procdown
-      const processor_id_type procup =
-        cast_int<processor_id_type>
-        ((comm.rank() + p) % comm.size());
-      const processor_id_type procdown =
-        cast_int<processor_id_type>
-        ((comm.size() + comm.rank() - p) %
-         comm.size());
-      std::vector<dof_id_type> request_to_fill_id;
-      comm.send_receive(procup, requested_objs_id[procup],
-                        procdown, request_to_fill_id);
-
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
-      libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                               received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
-    }
+  // Trade requests with only those processors we need to talk to
+  std::map<unsigned int, std::vector<dof_id_type> > request_to_fill_id;
+  comm.sparse_exchange(requested_objs_id, request_to_fill_id);
+
+  sync_requested_data(comm, request_to_fill_id, requested_objs_id, sync);
 }
 
 
@@ -348,39 +290,17 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
   // This function must be run on all processors at once
   libmesh_parallel_only(comm);
 
-  // Count the objects to ask each processor about
-  std::vector<dof_id_type>
-    ghost_objects_from_proc(comm.size(), 0);
-
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObject * obj = *it;
-      libmesh_assert (obj);
-      processor_id_type obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
   // Request sets to send to each processor
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_id(comm.size()),
-    requested_objs_parent_id(comm.size());
-  std::vector<std::vector<unsigned char> >
-    requested_objs_child_num(comm.size());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (processor_id_type p=0; p != comm.size(); ++p)
-    if (p != comm.rank())
-      {
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_parent_id[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_child_num[p].reserve(ghost_objects_from_proc[p]);
-      }
+  std::map<unsigned int, std::vector<dof_id_type> >
+    requested_objs_id,
+    requested_objs_parent_id;
+  std::map<unsigned int, std::vector<unsigned char> >
+    requested_objs_child_num;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       Elem * elem = *it;
+      libmesh_assert (elem);
       processor_id_type obj_procid = elem->processor_id();
       if (obj_procid == comm.rank() ||
           obj_procid == DofObject::invalid_processor_id)
@@ -396,51 +316,37 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
          (parent->which_child_am_i(elem)));
     }
 
-  // Trade requests with other processors
-  for (processor_id_type p=1; p != comm.size(); ++p)
+  // Trade requests with only those processors we need to talk to
+  std::map<unsigned int, std::vector<dof_id_type> > request_to_fill_parent_id;
+  std::map<unsigned int, std::vector<unsigned char> > request_to_fill_child_num;
+  comm.sparse_exchange(requested_objs_parent_id, request_to_fill_parent_id);
+  comm.sparse_exchange(requested_objs_child_num, request_to_fill_child_num);
+
+  // Find the id of each requested element
+  std::map<unsigned int, std::vector<dof_id_type> > request_to_fill_id;
+  for (std::map<unsigned int, std::vector<dof_id_type> >::const_iterator
+         it = request_to_fill_parent_id.begin();
+       it != request_to_fill_parent_id.end(); ++it)
     {
-      // Trade my requests with processor procup and procdown
-      const processor_id_type procup =
-        cast_int<processor_id_type>
-        ((comm.rank() + p) % comm.size());
-      const processor_id_type procdown =
-        cast_int<processor_id_type>
-        ((comm.size() + comm.rank() - p) %
-         comm.size());
-      std::vector<dof_id_type>   request_to_fill_parent_id;
-      std::vector<unsigned char> request_to_fill_child_num;
-      comm.send_receive(procup, requested_objs_parent_id[procup],
-                        procdown, request_to_fill_parent_id);
-      comm.send_receive(procup, requested_objs_child_num[procup],
-                        procdown, request_to_fill_child_num);
-
-      // Find the id of each requested element
-      std::size_t request_size = request_to_fill_parent_id.size();
-      std::vector<dof_id_type> request_to_fill_id(request_size);
-      for (std::size_t i=0; i != request_size; ++i)
+      const std::vector<dof_id_type> & parent_ids = it->second;
+      const std::vector<unsigned char> & child_nums =
+        request_to_fill_child_num[it->first];
+      libmesh_assert_equal_to (parent_ids.size(), child_nums.size());
+
+      std::vector<dof_id_type> & ids = request_to_fill_id[it->first];
+      ids.resize(parent_ids.size());
+      for (std::size_t i=0; i != ids.size(); ++i)
         {
-          Elem & parent = mesh.elem_ref(request_to_fill_parent_id[i]);
+          Elem & parent = mesh.elem_ref(parent_ids[i]);
           libmesh_assert(parent.has_children());
-          Elem * child = parent.child_ptr(request_to_fill_child_num[i]);
+          Elem * child = parent.child_ptr(child_nums[i]);
           libmesh_assert(child);
           libmesh_assert(child->active());
-          request_to_fill_id[i] = child->id();
+          ids[i] = child->id();
         }
-
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
-      libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                               received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
     }
+
+  sync_requested_data(comm, request_to_fill_id, requested_objs_id, sync);
 }
 #else
 template <typename Iterator,
@@ -469,56 +375,15 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
   // once.
   LIBMESH_BEST_UNORDERED_SET<dof_id_type> queried_nodes;
 
-  // Count the objects to ask each processor about
-  std::vector<dof_id_type>
-    ghost_objects_from_proc(comm.size(), 0);
-
-  for (MeshBase::const_element_iterator it = range_begin;
-       it != range_end; ++it)
-    {
-      const Elem * elem = *it;
-      libmesh_assert (elem);
-
-      for (unsigned int n=0; n != elem->n_nodes(); ++n)
-        {
-          const Node & node = elem->node_ref(n);
-
-          const processor_id_type proc_id = node.processor_id();
-          if (proc_id == comm.rank() ||
-              proc_id == DofObject::invalid_processor_id)
-            continue;
-
-          dof_id_type node_id = node.id();
-          if (!queried_nodes.count(node_id))
-            {
-              ghost_objects_from_proc[proc_id]++;
-              queried_nodes.insert(node_id);
-            }
-        }
-    }
-
-  // Now repeat that iteration, filling request sets this time.
-  queried_nodes.clear();
-
   // Request sets to send to each processor
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_elem_id(comm.size());
-  std::vector<std::vector<unsigned char> >
-    requested_objs_node_num(comm.size());
+  std::map<unsigned int, std::vector<dof_id_type> >
+    requested_objs_elem_id;
+  std::map<unsigned int, std::vector<unsigned char> >
+    requested_objs_node_num;
 
   // Keep track of current local ids for each too
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_id(comm.size());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (processor_id_type p=0; p != comm.size(); ++p)
-    if (p != comm.rank())
-      {
-        requested_objs_elem_id[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_node_num[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-      }
+  std::map<unsigned int, std::vector<dof_id_type> >
+    requested_objs_id;
 
   for (MeshBase::const_element_iterator it = range_begin;
        it != range_end; ++it)
@@ -538,51 +403,40 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
               proc_id == DofObject::invalid_processor_id)
             continue;
 
-          if (!queried_nodes.count(node_id))
+          if (queried_nodes.insert(node_id).second)
             {
               requested_objs_elem_id[proc_id].push_back(elem_id);
               requested_objs_node_num[proc_id].push_back
                 (cast_int<unsigned char>(n));
               requested_objs_id[proc_id].push_back(node_id);
-              queried_nodes.insert(node_id);
             }
         }
     }
 
-  // Trade requests with other processors
-  for (processor_id_type p=1; p != comm.size(); ++p)
+  // Trade requests with only those processors we need to talk to
+  std::map<unsigned int, std::vector<dof_id_type> > request_to_fill_elem_id;
+  std::map<unsigned int, std::vector<unsigned char> > request_to_fill_node_num;
+  comm.sparse_exchange(requested_objs_elem_id, request_to_fill_elem_id);
+  comm.sparse_exchange(requested_objs_node_num, request_to_fill_node_num);
+
+  // Find the id of each requested node
+  std::map<unsigned int, std::vector<dof_id_type> > request_to_fill_id;
+  for (std::map<unsigned int, std::vector<dof_id_type> >::const_iterator
+         it = request_to_fill_elem_id.begin();
+       it != request_to_fill_elem_id.end(); ++it)
     {
-      // Trade my requests with processor procup and procdown
-      const processor_id_type procup =
-        cast_int<processor_id_type>
-        ((comm.rank() + p) % comm.size());
-      const processor_id_type procdown =
-        cast_int<processor_id_type>
-        ((comm.size() + comm.rank() - p) %
-         comm.size());
-
-      libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                               ghost_objects_from_proc[procup]);
-      libmesh_assert_equal_to (requested_objs_elem_id[procup].size(),
-                               ghost_objects_from_proc[procup]);
-      libmesh_assert_equal_to (requested_objs_node_num[procup].size(),
-                               ghost_objects_from_proc[procup]);
-
-      std::vector<dof_id_type>   request_to_fill_elem_id;
-      std::vector<unsigned char> request_to_fill_node_num;
-      comm.send_receive(procup, requested_objs_elem_id[procup],
-                        procdown, request_to_fill_elem_id);
-      comm.send_receive(procup, requested_objs_node_num[procup],
-                        procdown, request_to_fill_node_num);
-
-      // Find the id of each requested element
-      std::size_t request_size = request_to_fill_elem_id.size();
-      std::vector<dof_id_type> request_to_fill_id(request_size);
-      for (std::size_t i=0; i != request_size; ++i)
+      const std::vector<dof_id_type> & elem_ids = it->second;
+      const std::vector<unsigned char> & node_nums =
+        request_to_fill_node_num[it->first];
+      libmesh_assert_equal_to (elem_ids.size(), node_nums.size());
+
+      std::vector<dof_id_type> & ids = request_to_fill_id[it->first];
+      ids.resize(elem_ids.size());
+      for (std::size_t i=0; i != ids.size(); ++i)
         {
-          const Elem & elem = mesh.elem_ref(request_to_fill_elem_id[i]);
+          const Elem & elem = mesh.elem_ref(elem_ids[i]);
 
-          const unsigned int n = request_to_fill_node_num[i];
+          const unsigned int n = node_nums[i];
           libmesh_assert_less (n, elem.n_nodes());
 
           const Node & node = elem.node_ref(n);
@@ -591,23 +445,11 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
           // synching processor ids
           // libmesh_assert_equal_to (node->processor_id(), comm.rank());
 
-          request_to_fill_id[i] = node.id();
+          ids[i] = node.id();
         }
-
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
-      libmesh_assert_equal_to (requested_objs_elem_id[procup].size(),
-                               received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
     }
+
+  sync_requested_data(comm, request_to_fill_id, requested_objs_id, sync);
 }
 
 
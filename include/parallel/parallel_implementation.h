@@ -411,6 +411,100 @@ inline void send_receive_vec_of_vec(const unsigned int dest_processor_id,
   request.wait();
 }
 
+
+
+// Internal helper functions to append a vector to, and read a vector
+// from, an MPI_PACKED buffer, for sparse_exchange()
+template <typename T>
+inline void pack_sparse_message(const std::vector<T> & vec,
+                                std::vector<char> & buf,
+                                const libMesh::Parallel::Communicator & comm)
+{
+  const unsigned int vecsize = libMesh::cast_int<unsigned int>(vec.size());
+
+  int sizesize=0, datasize=0;
+  libmesh_call_mpi
+    (MPI_Pack_size (1,
+                    libMesh::Parallel::StandardType<unsigned int>(),
+                    comm.get(), &sizesize));
+  libmesh_call_mpi
+    (MPI_Pack_size (libMesh::cast_int<int>(vecsize),
+                    libMesh::Parallel::StandardType<T>
+                    (vec.empty() ? libmesh_nullptr : &vec[0]),
+                    comm.get(), &datasize));
+
+  const std::size_t start = buf.size();
+  buf.resize(start + sizesize + datasize);
+
+  int pos=0;
+  libmesh_call_mpi
+    (MPI_Pack (const_cast<unsigned int *>(&vecsize), 1,
+               libMesh::Parallel::StandardType<unsigned int>(),
+               &buf[start], sizesize + datasize, &pos, comm.get()));
+
+  if (vecsize)
+    libmesh_call_mpi
+      (MPI_Pack (const_cast<T *>(&vec[0]),
+                 libMesh::cast_int<int>(vecsize),
+                 libMesh::Parallel::StandardType<T>(&vec[0]),
+                 &buf[start], sizesize + datasize, &pos, comm.get()));
+
+  buf.resize(start + pos);
+}
+
+template <typename T>
+inline void pack_sparse_message(const std::vector<std::vector<T> > & vec,
+                                std::vector<char> & buf,
+                                const libMesh::Parallel::Communicator & comm)
+{
+  // The outer size, then each inner vector
+  std::vector<unsigned int> vecsize(1, libMesh::cast_int<unsigned int>(vec.size()));
+  pack_sparse_message(vecsize, buf, comm);
+
+  for (std::size_t i=0; i != vec.size(); ++i)
+    pack_sparse_message(vec[i], buf, comm);
+}
+
+template <typename T>
+inline void unpack_sparse_message(const std::vector<char> & buf,
+                                  int & pos,
+                                  std::vector<T> & vec,
+                                  const libMesh::Parallel::Communicator & comm)
+{
+  unsigned int vecsize = 0;
+  libmesh_call_mpi
+    (MPI_Unpack (const_cast<char *>(&buf[0]),
+                 libMesh::cast_int<int>(buf.size()), &pos,
+                 &vecsize, 1,
+                 libMesh::Parallel::StandardType<unsigned int>(),
+                 comm.get()));
+
+  vec.resize(vecsize);
+
+  if (vecsize)
+    libmesh_call_mpi
+      (MPI_Unpack (const_cast<char *>(&buf[0]),
+                   libMesh::cast_int<int>(buf.size()), &pos,
+                   &vec[0], libMesh::cast_int<int>(vecsize),
+                   libMesh::Parallel::StandardType<T>(&vec[0]),
+                   comm.get()));
+}
+
+template <typename T>
+inline void unpack_sparse_message(const std::vector<char> & buf,
+                                  int & pos,
+                                  std::vector<std::vector<T> > & vec,
+                                  const libMesh::Parallel::Communicator & comm)
+{
+  std::vector<unsigned int> vecsize;
+  unpack_sparse_message(buf, pos, vecsize, comm);
+  libmesh_assert_equal_to (vecsize.size(), 1);
+
+  vec.resize(vecsize[0]);
+  for (std::size_t i=0; i != vec.size(); ++i)
+    unpack_sparse_message(buf, pos, vec[i], comm);
+}
+
 #endif // LIBMESH_HAVE_MPI
 
 } // Anonymous namespace
@@ -547,7 +641,8 @@ inline Communicator::Communicator () :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false) {}
+  _I_duped_it(false),
+  _n_sparse_exchanges(0) {}
 
 inline Communicator::Communicator (const communicator & comm) :
 #ifdef LIBMESH_HAVE_MPI
@@ -557,7 +652,8 @@ inline Communicator::Communicator (const communicator & comm) :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false)
+  _I_duped_it(false),
+  _n_sparse_exchanges(0)
 {
   this->assign(comm);
 }
@@ -638,7 +734,8 @@ inline Communicator::Communicator (const Communicator &) :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false)
+  _I_duped_it(false),
+  _n_sparse_exchanges(0)
 {
   libmesh_not_implemented();
 }
@@ -943,6 +1040,190 @@ inline void Communicator::barrier () const {}
 #endif
 
 
+
+#ifdef LIBMESH_HAVE_MPI
+inline void Communicator::sparse_exchange_packed
+(std::map<unsigned int, std::vector<char> > & send_buffers,
+ std::map<unsigned int, std::vector<char> > & recv_buffers) const
+{
+  recv_buffers.clear();
+
+  // Anything we send ourselves doesn't need MPI
+  std::map<unsigned int, std::vector<char> >::iterator
+    self = send_buffers.find(this->rank());
+  if (self != send_buffers.end() && !self->second.empty())
+    recv_buffers[this->rank()].swap(self->second);
+
+  if (this->size() == 1)
+    return;
+
+  LOG_SCOPE("sparse_exchange()", "Parallel");
+
+  // A processor which leaves an exchange early may already be
+  // sending messages for the next one while others are still probing
+  // for this one, so consecutive exchanges must use different tags.
+  // Two suffice: no processor can finish the next exchange until
+  // every processor has finished this one.
+  const MessageTag tag =
+    this->get_unique_tag(8192 + (_n_sparse_exchanges++ % 2));
+
+  // Start synchronous sends: each completes only once its message
+  // has begun to be received
+  std::vector<Request> send_requests;
+  send_requests.reserve(send_buffers.size());
+
+  std::map<unsigned int, std::vector<char> >::iterator
+    it = send_buffers.begin(), end = send_buffers.end();
+  for (; it != end; ++it)
+    if (it->first != this->rank() && !it->second.empty())
+      {
+        libmesh_assert_less (it->first, this->size());
+
+        send_requests.push_back(Request());
+        libmesh_call_mpi
+          (MPI_Issend (&it->second[0],
+                       cast_int<int>(it->second.size()), MPI_PACKED,
+                       it->first, tag.value(), this->get(),
+                       send_requests.back().get()));
+      }
+
+#if MPI_VERSION > 2
+  // Receive messages as they arrive.  Once all our sends have been
+  // received we enter a nonblocking barrier; when every processor
+  // has entered it, every message has been received.
+  Request barrier_request;
+  bool barrier_started = false;
+
+  while (true)
+    {
+      int flag = 0;
+      MPI_Status status;
+      libmesh_call_mpi
+        (MPI_Iprobe (MPI_ANY_SOURCE, tag.value(), this->get(),
+                     &flag, &status));
+
+      if (flag)
+        {
+          int count = 0;
+          libmesh_call_mpi
+            (MPI_Get_count (&status, MPI_PACKED, &count));
+
+          std::vector<char> & buf = recv_buffers[status.MPI_SOURCE];
+          libmesh_assert (buf.empty());
+          buf.resize(count);
+
+          libmesh_call_mpi
+            (MPI_Recv (&buf[0], count, MPI_PACKED, status.MPI_SOURCE,
+                       tag.value(), this->get(), MPI_STATUS_IGNORE));
+        }
+      else if (!barrier_started)
+        {
+          bool all_sent = true;
+          for (std::size_t i=0; i != send_requests.size(); ++i)
+            if (!send_requests[i].test())
+              {
+                all_sent = false;
+                break;
+              }
+
+          if (all_sent)
+            {
+              libmesh_call_mpi
+                (MPI_Ibarrier (this->get(), barrier_request.get()));
+              barrier_started = true;
+            }
+        }
+      else if (barrier_request.test())
+        break;
+    }
+#else
+  // Without a nonblocking barrier, count the incoming messages first
+  std::vector<unsigned int> n_messages(this->size(), 0);
+  for (it = send_buffers.begin(); it != end; ++it)
+    if (it->first != this->rank() && !it->second.empty())
+      n_messages[it->first] = 1;
+  this->sum(n_messages);
+
+  for (unsigned int m=0; m != n_messages[this->rank()]; ++m)
+    {
+      MPI_Status status;
+      libmesh_call_mpi
+        (MPI_Probe (MPI_ANY_SOURCE, tag.value(), this->get(), &status));
+
+      int count = 0;
+      libmesh_call_mpi
+        (MPI_Get_count (&status, MPI_PACKED, &count));
+
+      std::vector<char> & buf = recv_buffers[status.MPI_SOURCE];
+      libmesh_assert (buf.empty());
+      buf.resize(count);
+
+      libmesh_call_mpi
+        (MPI_Recv (&buf[0], count, MPI_PACKED, status.MPI_SOURCE,
+                   tag.value(), this->get(), MPI_STATUS_IGNORE));
+    }
+
+  Parallel::wait(send_requests);
+#endif
+}
+#else
+inline void Communicator::sparse_exchange_packed
+(std::map<unsigned int, std::vector<char> > & send_buffers,
+ std::map<unsigned int, std::vector<char> > & recv_buffers) const
+{
+  recv_buffers.clear();
+
+  std::map<unsigned int, std::vector<char> >::iterator
+    self = send_buffers.find(0);
+  if (self != send_buffers.end() && !self->second.empty())
+    recv_buffers[0].swap(self->second);
+}
+#endif
+
+
+
+template <typename T>
+inline void Communicator::sparse_exchange
+(const std::map<unsigned int, std::vector<T> > & data_to_send,
+ std::map<unsigned int, std::vector<T> > & data_received) const
+{
+  data_received.clear();
+
+#ifdef LIBMESH_HAVE_MPI
+  std::map<unsigned int, std::vector<char> > send_buffers, recv_buffers;
+
+  typename std::map<unsigned int, std::vector<T> >::const_iterator
+    it = data_to_send.begin(), end = data_to_send.end();
+  for (; it != end; ++it)
+    if (!it->second.empty())
+      {
+        // Anything we send ourselves can just be copied
+        if (it->first == this->rank())
+          data_received[it->first] = it->second;
+        else
+          pack_sparse_message(it->second, send_buffers[it->first], *this);
+      }
+
+  this->sparse_exchange_packed(send_buffers, recv_buffers);
+
+  std::map<unsigned int, std::vector<char> >::const_iterator
+    recv_it = recv_buffers.begin(), recv_end = recv_buffers.end();
+  for (; recv_it != recv_end; ++recv_it)
+    {
+      int pos = 0;
+      unpack_sparse_message(recv_it->second, pos,
+                            data_received[recv_it->first], *this);
+      libmesh_assert_equal_to (pos, cast_int<int>(recv_it->second.size()));
+    }
+#else
+  typename std::map<unsigned int, std::vector<T> >::const_iterator
+    self = data_to_send.find(0);
+  if (self != data_to_send.end() && !self->second.empty())
+    data_received[0] = self->second;
+#endif
+}
+
+
 // legacy e.g. Paralell::send() methods, requires
 // Communicator_World
 #ifndef LIBMESH_DISABLE_COMMWORLD
@@ -0,0 +1,124 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2016 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_PARALLEL_SHARED_FILE_H
+#define LIBMESH_PARALLEL_SHARED_FILE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+namespace Parallel {
+
+/**
+ * A binary file which all processors of a communicator open together
+ * and then read from or write to at explicit byte offsets.  With MPI
+ * this is an MPI-IO file, and the \p _all methods are collective, so
+ * that the MPI implementation can aggregate the accesses of all
+ * processors.  Without MPI it is a plain stream.
+ */
+class SharedFile : public ParallelObject
+{
+public:
+  /**
+   * Opens the file \p name on every processor of \p comm, for writing
+   * (truncating any old contents) if \p writing, for reading
+   * otherwise.
+   */
+  SharedFile (const Parallel::Communicator & comm,
+              const std::string & name,
+              const bool writing);
+
+  /**
+   * Destructor.  Closes the file.
+   */
+  ~SharedFile ();
+
+  /**
+   * Writes \p n_bytes from \p buf at byte \p offset, from this
+   * processor alone.
+   */
+  void write_at (const std::size_t offset,
+                 const void * buf,
+                 const std::size_t n_bytes);
+
+  /**
+   * Reads \p n_bytes into \p buf at byte \p offset, on this processor
+   * alone.
+   */
+  void read_at (const std::size_t offset,
+                void * buf,
+                const std::size_t n_bytes);
+
+  /**
+   * Collective version of \p write_at().  Every processor must call
+   * it, possibly with nothing to write.
+   */
+  void write_at_all (const std::size_t offset,
+                     const void * buf,
+                     const std::size_t n_bytes);
+
+  /**
+   * Collective version of \p read_at().
+   */
+  void read_at_all (const std::size_t offset,
+                    void * buf,
+                    const std::size_t n_bytes);
+
+  /**
+   * Convenience versions of the above for whole vectors; reads fill
+   * the vector at its current size.
+   */
+  template <typename T>
+  void write_at (const std::size_t offset, const std::vector<T> & data)
+  { this->write_at(offset, data.empty() ? libmesh_nullptr : &data[0], data.size()*sizeof(T)); }
+
+  template <typename T>
+  void read_at (const std::size_t offset, std::vector<T> & data)
+  { this->read_at(offset, data.empty() ? libmesh_nullptr : &data[0], data.size()*sizeof(T)); }
+
+  template <typename T>
+  void write_at_all (const std::size_t offset, const std::vector<T> & data)
+  { this->write_at_all(offset, data.empty() ? libmesh_nullptr : &data[0], data.size()*sizeof(T)); }
+
+  template <typename T>
+  void read_at_all (const std::size_t offset, std::vector<T> & data)
+  { this->read_at_all(offset, data.empty() ? libmesh_nullptr : &data[0], data.size()*sizeof(T)); }
+
+private:
+#ifdef LIBMESH_HAVE_MPI
+  MPI_File _fh;
+#else
+  std::fstream _stream;
+#endif
+};
+
+} // namespace Parallel
+
+} // namespace libMesh
+
+#endif // LIBMESH_PARALLEL_SHARED_FILE_H
@@ -168,6 +168,18 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * Constructor.  Takes the grainsize of \p r, but the beginning and
+   * end given.  The pthreads backend builds its subranges this way.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last) :
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
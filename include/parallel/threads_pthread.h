@@ -32,6 +32,7 @@
 #endif
 
 #include "libmesh/libmesh_logging.h"
+#include "libmesh/auto_ptr.h"
 #include <pthread.h>
 #include <algorithm>
 #include <vector>
@@ -176,33 +177,192 @@ private:
   pthread_mutexattr_t attr;
 };
 
+/**
+ * A unit of work which is run concurrently by several threads.  Each
+ * participating thread calls \p run() once with its own thread id;
+ * implementations are responsible for dividing the work between them.
+ */
+class PoolTask
+{
+public:
+  virtual ~PoolTask () {}
+
+  virtual void run (unsigned int thread_id) = 0;
+};
+
+/**
+ * A persistent pool of pthreads.  Worker threads are created the
+ * first time they are needed and then sleep between tasks, so that
+ * each threaded loop does not pay the cost of creating and joining
+ * its own threads.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * Runs \p task.run(i) for every i in [0, \p n_threads), with the
+   * calling thread acting as thread 0, and returns once every thread
+   * has finished.  If the pool is already busy (e.g. in a nested
+   * threaded loop) the calling thread runs \p task.run(i) for each i
+   * in turn.
+   */
+  static void execute (PoolTask & task, unsigned int n_threads);
+};
+
+/**
+ * A set of \p n_chunks work items, initially dealt out in contiguous
+ * blocks to the deques of \p n_threads threads.  Each thread takes
+ * chunks from the front of its own deque; a thread whose deque is
+ * empty steals half of the remaining chunks from the back of another
+ * thread's deque.  This balances loops whose per-item cost varies,
+ * while each thread still mostly works on contiguous data.
+ */
+class WorkStealingChunks
+{
+public:
+  WorkStealingChunks (std::size_t n_chunks, unsigned int n_threads);
+
+  ~WorkStealingChunks ();
+
+  /**
+   * Sets \p chunk to the next chunk to be processed by thread
+   * \p thread_id.  Returns false once no work remains anywhere.
+   */
+  bool next (unsigned int thread_id, std::size_t & chunk);
+
+private:
+  /**
+   * The chunks [begin, end) still owned by one thread.  Padded so
+   * that neighboring deques do not share a cache line.
+   */
+  struct Deque
+  {
+    Deque () : begin(0), end(0) {}
+    spin_mutex mutex;
+    std::size_t begin, end;
+    char padding[64];
+  };
+
+  Deque * _deques;
+  unsigned int _n_threads;
+};
+
+/**
+ * Splits a range into chunks of at least the range's grain size
+ * (but small enough that every thread gets work), and hands them out
+ * to threads through a \p WorkStealingChunks scheduler.
+ */
 template <typename Range>
-unsigned int num_pthreads(Range & range)
+class ChunkedRange
 {
-  unsigned int min = std::min((std::size_t)libMesh::n_threads(), range.size());
-  return min > 0 ? min : 1;
-}
+public:
+  ChunkedRange (const Range & range, unsigned int n_threads) :
+    _range(range),
+    _size(range.size()),
+    _n_chunks(0)
+  {
+    if (!_size)
+      return;
+
+    // Aim for several chunks per thread, so that stealing has
+    // something to work with
+    const std::size_t chunks_per_thread = 16;
+    std::size_t chunk_size =
+      (_size + n_threads*chunks_per_thread - 1) / (n_threads*chunks_per_thread);
+
+    // Respect the grain size, unless that would leave threads idle
+    const std::size_t even_size = (_size + n_threads - 1) / n_threads;
+    chunk_size = std::max(chunk_size,
+                          std::min(std::size_t(range.grainsize()), even_size));
+    chunk_size = std::max(chunk_size, std::size_t(1));
+
+    _n_chunks = (_size + chunk_size - 1) / chunk_size;
+  }
 
+  std::size_t n_chunks () const { return _n_chunks; }
+
+  /**
+   * Returns a new subrange for chunk \p c, to be deleted by the caller.
+   */
+  Range * build_chunk (std::size_t c) const
+  {
+    const std::size_t first = c * _size / _n_chunks;
+    const std::size_t last = (c+1) * _size / _n_chunks;
+
+    return new Range(_range, _range.begin() + first, _range.begin() + last);
+  }
+
+private:
+  const Range & _range;
+  std::size_t _size, _n_chunks;
+};
+
+/**
+ * The \p PoolTask run by \p parallel_for().
+ */
 template <typename Range, typename Body>
-class RangeBody
+class ParallelForTask : public PoolTask
 {
 public:
-  Range * range;
-  Body * body;
+  ParallelForTask (const Range & range, const Body & body,
+                   unsigned int n_threads) :
+    _chunks(range, n_threads),
+    _scheduler(_chunks.n_chunks(), n_threads),
+    _body(body)
+  {}
+
+  virtual void run (unsigned int thread_id) libmesh_override
+  {
+    std::size_t c;
+    while (_scheduler.next(thread_id, c))
+      {
+        UniquePtr<Range> chunk (_chunks.build_chunk(c));
+        _body(*chunk);
+      }
+  }
+
+private:
+  ChunkedRange<Range> _chunks;
+  WorkStealingChunks _scheduler;
+  const Body & _body;
 };
 
+/**
+ * The \p PoolTask run by \p parallel_reduce().  Unlike \p
+ * parallel_for() this does not steal work: thread i accumulates the
+ * i-th of \p n_threads contiguous blocks of the range into its own \p
+ * Body, so that joining the bodies in thread order combines the
+ * partial results in range order.  This keeps reductions which are
+ * not commutative (or not exactly associative, like floating point
+ * sums) deterministic for a given number of threads.
+ */
 template <typename Range, typename Body>
-void * run_body(void * args)
+class ParallelReduceTask : public PoolTask
 {
-  RangeBody<Range, Body> * range_body = (RangeBody<Range, Body> *)args;
+public:
+  ParallelReduceTask (const Range & range, std::vector<Body *> & bodies) :
+    _range(range),
+    _bodies(bodies)
+  {}
 
-  Body & body = *range_body->body;
-  Range & range = *range_body->range;
+  virtual void run (unsigned int thread_id) libmesh_override
+  {
+    const std::size_t size = _range.size();
+    const std::size_t n_threads = _bodies.size();
+    const std::size_t first = thread_id * size / n_threads;
+    const std::size_t last = (thread_id+1) * size / n_threads;
 
-  body(range);
+    if (first == last)
+      return;
 
-  return libmesh_nullptr;
-}
+    Range subrange(_range, _range.begin() + first, _range.begin() + last);
+    (*_bodies[thread_id])(subrange);
+  }
+
+private:
+  const Range & _range;
+  std::vector<Body *> & _bodies;
+};
 
 /**
  * Scheduler to manage threads.
@@ -244,68 +404,14 @@ void parallel_for (const Range & range, const Body & body)
     libMesh::perflog.disable_logging();
 #endif
 
-  unsigned int n_threads = num_pthreads(range);
-
-  std::vector<Range *> ranges(n_threads);
-  std::vector<RangeBody<const Range, const Body> > range_bodies(n_threads);
-  std::vector<pthread_t> threads(n_threads);
-
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
+  const unsigned int n_threads =
+    cast_int<unsigned int>(std::max(std::min(std::size_t(libMesh::n_threads()),
+                                             std::size_t(range.size())),
+                                    std::size_t(1)));
 
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
+  ParallelForTask<Range, Body> task(range, body, n_threads);
 
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = &body;
-    }
-
-  // Create the threads.  It may seem redundant to wrap a pragma in
-  // #ifdefs... but GCC warns about an "unknown pragma" if it
-  // encounters this line of code when -fopenmp is not passed to the
-  // compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], libmesh_nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    pthread_join(threads[i], libmesh_nullptr);
-#endif
-
-  // Clean up
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
+  ThreadPool::execute(task, n_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
@@ -341,80 +447,28 @@ void parallel_reduce (const Range & range, Body & body)
     libMesh::perflog.disable_logging();
 #endif
 
-  unsigned int n_threads = num_pthreads(range);
-
-  std::vector<Range *> ranges(n_threads);
-  std::vector<Body *> bodies(n_threads);
-  std::vector<RangeBody<Range, Body> > range_bodies(n_threads);
+  const unsigned int n_threads =
+    cast_int<unsigned int>(std::max(std::min(std::size_t(libMesh::n_threads()),
+                                             std::size_t(range.size())),
+                                    std::size_t(1)));
 
   // Create copies of the body for each thread
+  std::vector<Body *> bodies(n_threads);
   bodies[0] = &body; // Use the original body for the first one
   for (unsigned int i=1; i<n_threads; i++)
     bodies[i] = new Body(body, Threads::split());
 
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
+  ParallelReduceTask<Range, Body> task(range, bodies);
 
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = bodies[i];
-    }
-
-  // Create the threads
-  std::vector<pthread_t> threads(n_threads);
-
-  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
-  // warns about an "unknown pragma" if it encounters this line of
-  // code when -fopenmp is not passed to the compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], libmesh_nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for (unsigned int i=0; i<n_threads; i++)
-    pthread_join(threads[i], libmesh_nullptr);
-#endif
+  ThreadPool::execute(task, n_threads);
 
-  // Join them all down to the original Body
+  // Join them all down to the original Body, in range order
   for (unsigned int i=n_threads-1; i != 0; i--)
     bodies[i-1]->join(*bodies[i]);
 
   // Clean up
   for (unsigned int i=1; i<n_threads; i++)
     delete bodies[i];
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
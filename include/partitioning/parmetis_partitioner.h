@@ -69,7 +69,9 @@ protected:
    * Parmetis can handle dynamically repartitioning a mesh such
    * that the redistribution costs are minimized.  This method
    * takes a previously partitioned domain (which may have
-   * then been adaptively refined) and repartitions it.
+   * then been adaptively refined) and repartitions it.  In
+   * incremental mode the current partitioning is the starting point,
+   * and Parmetis trades some edge cut for less migration.
    */
   virtual void _do_repartition (MeshBase & mesh,
                                 const unsigned int n) libmesh_override;
@@ -82,6 +84,14 @@ protected:
 
 private:
 
+  /**
+   * Partition the \p MeshBase into \p n_sbdmns subdomains, starting
+   * from the current partitioning if \p incremental.
+   */
+  void partition_graph (MeshBase & mesh,
+                        const unsigned int n_sbdmns,
+                        const bool incremental);
+
   // These methods & data only need to be available if the
   // ParMETIS library is available.
 #ifdef LIBMESH_HAVE_PARMETIS
@@ -89,7 +99,8 @@ private:
   /**
    * Initialize data structures.
    */
-  void initialize (const MeshBase & mesh, const unsigned int n_sbdmns);
+  void initialize (const MeshBase & mesh, const unsigned int n_sbdmns,
+                   const bool incremental);
 
   /**
    * Build the graph.
@@ -49,7 +49,12 @@ public:
   /**
    * Constructor.
    */
-  Partitioner () : _weights(libmesh_nullptr) {}
+  Partitioner () :
+    _weights(libmesh_nullptr),
+    _incremental(false),
+    _imbalance_tolerance(0.05),
+    _n_migrated_elem(0)
+  {}
 
   /**
    * Destructor. Virtual so that we can derive from this class.
@@ -109,6 +114,9 @@ public:
    * is required since some partitoning algorithms can repartition
    * more efficiently than computing a new partitioning from scratch.
    * The default behavior is to simply call this->partition(mesh,n)
+   *
+   * In incremental mode, see \p set_incremental_repartition(), a
+   * partitioning which is already balanced is left alone.
    */
   void repartition (MeshBase & mesh,
                     const unsigned int n);
@@ -120,6 +128,24 @@ public:
    */
   void repartition (MeshBase & mesh);
 
+  /**
+   * Makes \p repartition() incremental, if \p incremental is true:
+   * elements keep their processor ids where possible, and only as
+   * many move as are needed to bring the weight of every part within
+   * a fraction \p tolerance of the average; \p tolerance must be
+   * positive.  Partitioners which do not support this repartition
+   * from scratch whenever the current partitioning is out of
+   * balance.
+   */
+  void set_incremental_repartition (bool incremental,
+                                    Real tolerance = 0.05);
+
+  /**
+   * \returns the number of active elements which were given a new
+   * processor id by the last \p partition() or \p repartition().
+   */
+  dof_id_type n_migrated_elem () const { return _n_migrated_elem; }
+
   /**
    * This function
    */
@@ -175,6 +201,15 @@ protected:
   virtual void _do_repartition (MeshBase & mesh,
                                 const unsigned int n) { this->_do_partition (mesh, n); }
 
+  /**
+   * \returns the weight of the heaviest of the \p n parts of the
+   * current partitioning of \p mesh, relative to the average part
+   * weight.  The elements are weighted by \p _weights if we have
+   * them.
+   */
+  Real imbalance (const MeshBase & mesh,
+                  const unsigned int n) const;
+
   /**
    * The blocksize to use when doing blocked parallel communication.  This limits the
    * maximum vector size which can be used in a single communication step.
@@ -185,6 +220,22 @@ protected:
    * The weights that might be used for partitioning.
    */
   ErrorVector * _weights;
+
+  /**
+   * Whether \p repartition() should keep elements where they are
+   * when it can.
+   */
+  bool _incremental;
+
+  /**
+   * The relative imbalance an incremental repartitioning tolerates.
+   */
+  Real _imbalance_tolerance;
+
+  /**
+   * The number of active elements moved by the last partitioning.
+   */
+  dof_id_type _n_migrated_elem;
 };
 
 
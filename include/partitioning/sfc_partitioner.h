@@ -31,7 +31,15 @@ namespace libMesh
 
 /**
  * The \p SFCPartitioner uses a Hilbert or Morton-ordered space
- * filling curve to partition the elements.
+ * filling curve to partition the elements.  Each processor computes
+ * the curve keys of the active elements it owns, the keys are sorted
+ * in parallel, and the curve is cut into pieces of equal total
+ * weight, so the mesh need not be serialized.
+ *
+ * Incremental repartitioning keeps each element in its current part
+ * if it lies within the tolerance of that part's stretch of the
+ * curve, so after adaptive refinement only elements near the cuts
+ * move.
  */
 class SFCPartitioner : public Partitioner
 {
@@ -60,6 +68,11 @@ public:
    */
   void set_sfc_type (const std::string & sfc_type);
 
+  /**
+   * Attach weights to balance the partitioning by, indexed by element
+   * id.  Without weights every active element counts the same.
+   */
+  virtual void attach_weights(ErrorVector * weights) libmesh_override { _weights = weights; }
 
 protected:
 
@@ -69,9 +82,25 @@ protected:
   virtual void _do_partition (MeshBase & mesh,
                               const unsigned int n) libmesh_override;
 
+  /**
+   * Repartition the \p MeshBase into \p n subdomains, incrementally
+   * if we have been asked to.
+   */
+  virtual void _do_repartition (MeshBase & mesh,
+                                const unsigned int n) libmesh_override;
+
 
 private:
 
+  /**
+   * Cuts the curve through the active elements into \p n pieces.  If
+   * \p incremental, elements near enough their current piece stay
+   * in it.
+   */
+  void sfc_partition (MeshBase & mesh,
+                      const unsigned int n,
+                      const bool incremental);
+
   /**
    * The type of space-filling curve to use.  Hilbert by default.
    */
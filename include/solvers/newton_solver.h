@@ -25,6 +25,7 @@
 #include "libmesh/linear_solver.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/diff_solver.h"
+#include "libmesh/shell_matrix.h"
 
 // C++ includes
 
@@ -132,8 +133,43 @@ public:
    */
   Real linear_tolerance_multiplier;
 
+  /**
+   * This function enables the user to provide a shell matrix, i.e. a
+   * matrix that is not stored element-wise, but as a function, to
+   * use as the Jacobian in the linear solves.  The stored
+   * Jacobian matrix is then not assembled; the matrix named
+   * "Preconditioner", if the system has one, is still passed to the
+   * linear solver.  You can reset this behaviour to its original
+   * state by supplying a \p NULL pointer to this function.
+   *
+   * While a shell matrix is attached, \p solve() frees the storage
+   * of the system matrix; it is reallocated by the first \p solve()
+   * after the shell matrix is detached.
+   *
+   * A \p FEMJacobianShellMatrix provides the Jacobian action of an
+   * \p FEMSystem.
+   */
+  void attach_shell_matrix (ShellMatrix<Number> * shell_matrix)
+  { _shell_matrix = shell_matrix; }
+
+  /**
+   * Detaches a shell matrix.  Same as \p attach_shell_matrix(libmesh_nullptr).
+   */
+  void detach_shell_matrix () { attach_shell_matrix(libmesh_nullptr); }
+
+  /**
+   * Returns a pointer to the currently attached shell matrix, if any,
+   * or \p NULL else.
+   */
+  ShellMatrix<Number> * get_shell_matrix() { return _shell_matrix; }
+
 protected:
 
+  /**
+   * User supplied shell matrix or \p NULL if no shell matrix is used.
+   */
+  ShellMatrix<Number> * _shell_matrix;
+
   /**
    * The \p LinearSolver defines the interface used to
    * solve the linear_implicit system.  This class handles all the
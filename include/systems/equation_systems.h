@@ -85,7 +85,8 @@ public:
   enum WriteFlags { WRITE_DATA             = 1,
                     WRITE_ADDITIONAL_DATA  = 2,
                     WRITE_PARALLEL_FILES   = 4,
-                    WRITE_SERIAL_FILES     = 8 };
+                    WRITE_SERIAL_FILES     = 8,
+                    WRITE_CHUNKED_FILE     = 16 };
 
   /**
    * Constructor.
@@ -294,6 +295,20 @@ public:
   UniquePtr<NumericVector<Number> >
   build_parallel_solution_vector(const std::set<std::string> * system_names=libmesh_nullptr) const;
 
+  /**
+   * A version of build_parallel_solution_vector which never forms a
+   * vector over all the nodes of the mesh.  Fills \p node_ids with
+   * the ids of the nodes this processor owns, in local_nodes_begin()
+   * order, and \p soln with their node-major averaged nodal values,
+   * \p soln[i*n_vars+v] being the value of variable \p v at node \p
+   * node_ids[i].  Contributions of each processor's elements to nodes
+   * owned by other processors are sent only to those owners, and the
+   * node numbering need not be contiguous.
+   */
+  void build_local_nodal_solution (std::vector<dof_id_type> & node_ids,
+                                   std::vector<Number> & soln,
+                                   const std::set<std::string> * system_names=libmesh_nullptr) const;
+
   /**
    * Retrieve the solution data for CONSTANT MONOMIALs.  If \p names
    * is populated, only the variables corresponding to those names will
@@ -372,6 +387,12 @@ public:
    * Note that the solution data can be omitted by calling
    * this routine with WRITE_DATA omitted in the write_flags argument.
    *
+   * With WRITE_CHUNKED_FILE, every processor compresses its local
+   * solution data and writes it to its own chunk of a single file,
+   * \p name followed by ".chunks", which starts with a table of chunk
+   * offsets.  Like WRITE_PARALLEL_FILES, this must be read back with
+   * the same partitioning.
+   *
    * If XdrMODE is omitted, it will be inferred as WRITE for filenames
    * containing .xda or as ENCODE for filenames containing .xdr
    *
@@ -516,6 +537,25 @@ private:
    * is to avoid coupling this header file to mesh.h, and elem.h.
    */
   void _add_system_to_nodes_and_elems();
+
+  /**
+   * \returns the number of nodal output variables of the systems in
+   * \p system_names, or of all systems, counting each component of a
+   * vector variable separately, as build_variable_names() does.
+   */
+  unsigned int n_nodal_output_vars (const std::set<std::string> * system_names) const;
+
+  /**
+   * The averaging loop shared by build_parallel_solution_vector() and
+   * build_local_nodal_solution().  Interpolates each output variable
+   * to the nodes of each active local element, and calls
+   * \p accumulate(node_id, v, value) for each node and variable
+   * \p v.  \p value is \p NULL where the variable is inactive but the
+   * element still counts towards the node's average.
+   */
+  template <typename Accumulator>
+  void accumulate_nodal_solution (const std::set<std::string> * system_names,
+                                  Accumulator & accumulate) const;
 };
 
 
@@ -0,0 +1,119 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2016 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FEM_JACOBIAN_SHELL_MATRIX_H
+#define LIBMESH_FEM_JACOBIAN_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fem_system.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/shell_matrix.h"
+
+namespace libMesh
+{
+
+/**
+ * This class wraps the Jacobian of an \p FEMSystem, evaluated at the
+ * system's current solution, as a shell matrix.  Products with it
+ * recompute the element Jacobians on the fly and never store a
+ * global matrix, so attaching one to a \p NewtonSolver gives a
+ * matrix-free Newton-Krylov method.  The matrix diagonal is
+ * available for Jacobi preconditioning.
+ *
+ * Each product costs one element Jacobian assembly, so this pays off
+ * when memory or bandwidth, rather than assembly, limits a solve.
+ */
+class FEMJacobianShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor.  The system must outlive this object.
+   */
+  explicit
+  FEMJacobianShellMatrix (FEMSystem & sys) :
+    ShellMatrix<Number>(sys.comm()),
+    _sys(sys) {}
+
+  /**
+   * Destructor.
+   */
+  virtual ~FEMJacobianShellMatrix () {}
+
+  /**
+   * @returns \p m, the row-dimension of the matrix where the marix is
+   * \f$ M \times N \f$.
+   */
+  virtual numeric_index_type m () const libmesh_override
+  { return _sys.n_dofs(); }
+
+  /**
+   * @returns \p n, the column-dimension of the matrix where the marix
+   * is \f$ M \times N \f$.
+   */
+  virtual numeric_index_type n () const libmesh_override
+  { return _sys.n_dofs(); }
+
+  /**
+   * Multiplies the matrix with \p arg and stores the result in \p
+   * dest.
+   */
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const libmesh_override
+  { _sys.jacobian_vector_mult(arg, dest); }
+
+  /**
+   * Multiplies the matrix with \p arg and adds the result to \p dest.
+   */
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const libmesh_override
+  {
+    // Reuse the temporary across Krylov iterations
+    if (!_temp.get() || _temp->type() != dest.type() ||
+        _temp->size() != dest.size() ||
+        _temp->local_size() != dest.local_size())
+      _temp = dest.zero_clone();
+
+    _sys.jacobian_vector_mult(arg, *_temp);
+    dest.add(*_temp);
+  }
+
+  /**
+   * Copies the diagonal part of the matrix into \p dest.
+   */
+  virtual void get_diagonal (NumericVector<Number> & dest) const libmesh_override
+  { _sys.jacobian_diagonal(dest); }
+
+private:
+
+  /**
+   * The system whose Jacobian this is.
+   */
+  FEMSystem & _sys;
+
+  /**
+   * Work vector for \p vector_mult_add().
+   */
+  mutable UniquePtr<NumericVector<Number> > _temp;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_FEM_JACOBIAN_SHELL_MATRIX_H
@@ -22,6 +22,7 @@
 
 // Local Includes
 #include "libmesh/diff_system.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/fem_physics.h"
 
 // C++ includes
@@ -77,6 +78,38 @@ public:
    */
   typedef DifferentiableSystem Parent;
 
+  /**
+   * Reinitializes the member data fields associated with
+   * the system, so that, e.g., \p assemble() may be used.
+   */
+  virtual void reinit () libmesh_override;
+
+  /**
+   * Reinitializes the constraints for this system.
+   */
+  virtual void reinit_constraints () libmesh_override;
+
+  /**
+   * Strategies for adding element contributions to the global
+   * matrix and residual during a threaded \p assembly().
+   *
+   * LOCKED_ASSEMBLY adds each element matrix and vector to the global
+   * system as soon as it is computed, with every thread sharing one
+   * lock around that insertion.
+   *
+   * STAGED_ASSEMBLY accumulates contributions in thread-local
+   * buffers and merges each buffer into the global system in a
+   * single locked pass, either when a few hundred element matrices
+   * have been staged or at the end of each threaded range.  Each
+   * staged element matrix goes to the global matrix in one
+   * \p add_matrix() call, and residual entries which share a global
+   * dof are combined first.  This avoids lock contention in the
+   * element loop at the cost of extra memory, and works with any
+   * \p SparseMatrix and \p NumericVector implementation.
+   */
+  enum AssemblyMode { LOCKED_ASSEMBLY = 0,
+                      STAGED_ASSEMBLY };
+
   /**
    * Prepares \p matrix or \p rhs for matrix assembly.
    * Users may reimplement this to add pre- or post-assembly
@@ -86,6 +119,24 @@ public:
                          bool get_jacobian,
                          bool apply_heterogeneous_constraints = false) libmesh_override;
 
+  /**
+   * Computes \p dest = J * \p arg, where J is the Jacobian that
+   * \p assembly() would add to \p matrix, without assembling it.
+   * Element Jacobians are computed in a threaded element loop,
+   * constrained as in \p assembly(), and applied directly to the
+   * local entries of \p arg.  The Jacobian is evaluated at the
+   * current contents of \p current_local_solution.
+   */
+  void jacobian_vector_mult (const NumericVector<Number> & arg,
+                             NumericVector<Number> & dest);
+
+  /**
+   * Computes the diagonal of the Jacobian into \p dest, as for
+   * \p jacobian_vector_mult().  This allows Jacobi preconditioning of
+   * matrix-free solves.
+   */
+  void jacobian_diagonal (NumericVector<Number> & dest);
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
@@ -161,6 +212,25 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * The strategy \p assembly() uses to add element contributions to
+   * the global system.  Defaults to LOCKED_ASSEMBLY.
+   */
+  AssemblyMode assembly_mode;
+
+  /**
+   * If \p true, \p assembly() on more than one
+   * processor only starts the update of \p current_local_solution,
+   * assembles the elements whose degrees of freedom are all local
+   * and unconstrained while ghost values are in flight, and then
+   * completes the update before assembling the rest.  Only set it
+   * if element assembly reads no ghosted data other than
+   * \p current_local_solution, and if \p update() has not been
+   * overridden to do more than \p System::update().  Defaults to
+   * \p false.
+   */
+  bool overlap_ghost_updates;
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
@@ -241,6 +311,41 @@ protected:
   virtual void init_data () libmesh_override;
 
 private:
+
+  /**
+   * Implements \p jacobian_vector_mult() and, when \p arg is NULL,
+   * \p jacobian_diagonal().
+   */
+  void jacobian_action (const NumericVector<Number> * arg,
+                        NumericVector<Number> & dest);
+
+  /**
+   * \returns the range of active local elements, built on first use
+   * and reused until the system is reinitialized.
+   */
+  const ConstElemRange & active_local_elem_range ();
+
+  /**
+   * Cached by \p active_local_elem_range(), and cleared by
+   * \p init_data() and \p reinit().
+   */
+  UniquePtr<ConstElemRange> _active_local_elem_range;
+
+  /**
+   * Sorts the active local elements, on first use, into those whose
+   * dofs are all owned by this processor and unconstrained and the
+   * rest, for overlapped ghost updates.
+   */
+  void split_interior_elements ();
+
+  /**
+   * Filled by \p split_interior_elements() when \p
+   * _interior_elems_valid is false, which \p init_data(), \p reinit()
+   * and \p reinit_constraints() make it.
+   */
+  std::vector<const Elem *> _interior_elems, _ghosted_elems;
+  bool _interior_elems_valid;
+
   std::vector<Real> _numerical_jacobian_h_for_var;
 };
 
@@ -49,6 +49,7 @@ class EquationSystems;
 class MeshBase;
 class Xdr;
 class DofMap;
+class FEMapCache;
 template <typename Output> class FunctionBase;
 class Parameters;
 class ParameterVector;
@@ -260,6 +261,20 @@ public:
    */
   virtual void update ();
 
+  /**
+   * Starts the same update as \p update() without waiting for the
+   * values owned by other processors.  The locally owned entries of
+   * \p current_local_solution are up to date when this returns; the
+   * rest are only valid after \p end_update().  \p solution must not
+   * be modified in between.
+   */
+  void begin_update ();
+
+  /**
+   * Completes the update started by \p begin_update().
+   */
+  void end_update ();
+
   /**
    * Prepares \p matrix and \p _dof_map for matrix assembly.
    * Does not actually assemble anything.  For matrix assembly,
@@ -705,6 +720,38 @@ public:
    */
   DofMap & get_dof_map();
 
+  /**
+   * Enables caching of the element map (\p xyz, \p JxW and the
+   * inverse map derivatives) at the quadrature points of the \p
+   * FEMContext objects built for this system, so that repeated
+   * assemblies on a mesh which does not move copy the map of each
+   * non-affine element instead of computing it again.  The cache is
+   * filled as elements are first reinitialized, and is emptied by \p
+   * init(), \p reinit() and \p FEMSystem::mesh_position_set().
+   *
+   * At most \p max_bytes of memory are used; the maps of elements
+   * which do not fit are computed on every reinit as usual.  A size
+   * of 0, the default, disables the cache.
+   */
+  void set_fe_map_cache_size (std::size_t max_bytes);
+
+  /**
+   * \returns the memory limit for the element map cache, or 0 if the
+   * cache is disabled.
+   */
+  std::size_t fe_map_cache_size () const;
+
+  /**
+   * \returns the element map cache, or \p NULL if it is disabled.
+   */
+  FEMapCache * get_fe_map_cache () const;
+
+  /**
+   * Empties the element map cache.  Call this after moving nodes
+   * other than through \p FEMSystem::mesh_position_set().
+   */
+  void clear_fe_map_cache ();
+
   /**
    * @returns a constant reference to this system's parent EquationSystems object.
    */
@@ -1320,6 +1367,28 @@ public:
   void write_parallel_data (Xdr & io,
                             const bool write_additional_data) const;
 
+  /**
+   * Appends the local solution components and, if \p
+   * write_additional_data, the local components of the additional
+   * vectors to \p chunk.  Each vector is stored in independently
+   * compressed blocks, which are compressed in parallel.  This is
+   * the per-processor part of a file written by
+   * \p EquationSystems::write() with \p WRITE_CHUNKED_FILE.
+   */
+  void write_chunked_data (std::vector<char> & chunk,
+                           const bool write_additional_data) const;
+
+  /**
+   * Reads the vectors written by \p write_chunked_data() from \p
+   * chunk, which must not read past \p chunk_end, and advances \p
+   * chunk past them.  As with \p read_parallel_data(), the mesh must
+   * be partitioned as it was when the data was written.
+   */
+  template <typename InValType>
+  void read_chunked_data (const char * & chunk,
+                          const char * chunk_end,
+                          const bool read_additional_data);
+
   /**
    * @returns a string containing information about the
    * system.
@@ -1702,6 +1771,15 @@ private:
                           unsigned int var,
                           FEMNormType norm_type) const;
 
+  /**
+   * Fills \p dof_indices with the local dofs of the variables \p
+   * vars, in the order used by \p write_parallel_data(): for each
+   * variable the node dofs and then the element dofs, by increasing
+   * id, and the SCALAR dofs last on the last processor.
+   */
+  void local_io_dof_indices (const std::vector<unsigned int> & vars,
+                             std::vector<dof_id_type> & dof_indices) const;
+
   /**
    * Reads an input vector from the stream \p io and assigns
    * the values to a set of \p DofObjects.  This method uses
@@ -1846,6 +1924,12 @@ private:
    */
   UniquePtr<DofMap> _dof_map;
 
+  /**
+   * The maps of elements at the quadrature points, kept between
+   * assemblies.  Filling it does not change the system.
+   */
+  UniquePtr<FEMapCache> _fe_map_cache;
+
   /**
    * Constant reference to the \p EquationSystems object
    * used for the simulation.
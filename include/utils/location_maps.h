@@ -27,9 +27,13 @@
 #include "libmesh/point.h"
 
 // C++ Includes   -----------------------------------
-#include LIBMESH_INCLUDE_UNORDERED_MULTIMAP
+#include <cstddef>
 #include <vector>
 
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+#include <atomic>
+#endif
+
 namespace libMesh
 {
 
@@ -42,36 +46,109 @@ class Node;
 /**
  * Data structures that enable location-based lookups
  * The key is a hash of the Point location.
- * For efficiency we will use a hashed multimap if it is
- * available, otherwise a regular multimap.
+ *
+ * Points are binned into a grid over the mesh bounding box, and the
+ * bins are stored in an open-addressing hash table with linear
+ * probing, so entries need no separate allocation.  The grid is never
+ * finer than the map tolerance, so any object within that tolerance
+ * of a query point lies in the query bin or one of its neighbors.
+ *
+ * Objects can be inserted concurrently: \p insert(const std::vector<T *> &)
+ * sizes the table once and then claims slots with atomic
+ * compare-and-swap from multiple threads.  Without C++11 atomics it
+ * inserts them one at a time instead.
  */
 template <typename T>
 class LocationMap
 {
-  typedef LIBMESH_BEST_UNORDERED_MULTIMAP<unsigned int, T *> map_type;
 public:
+  LocationMap();
+
   void init(MeshBase &);
 
-  void clear() { _map.clear(); }
+  void clear();
+
+  /**
+   * Makes room for \p n objects without rehashing.
+   */
+  void reserve(std::size_t n);
 
   void insert(T &);
 
-  bool empty() const { return _map.empty(); }
+  /**
+   * Inserts all of \p objects, using multiple threads when they and
+   * C++11 atomics are available.
+   */
+  void insert(const std::vector<T *> & objects);
+
+  bool empty() const { return _size == 0; }
+
+  std::size_t size() const { return _size; }
 
-  T * find(const Point &,
-           const Real tol = TOLERANCE);
+  /**
+   * Sets the absolute tolerance used by \p find() and for sizing the
+   * bins.  Call this before \p init(); defaults to \p TOLERANCE.
+   */
+  void set_tolerance(const Real tol) { _tolerance = tol; }
+
+  Real tolerance() const { return _tolerance; }
+
+  /**
+   * @returns an object within \p tolerance() of \p p, or \p NULL.
+   */
+  T * find(const Point & p) const;
+
+  /**
+   * @returns an object within \p tol of \p p, or \p NULL.  \p tol
+   * should not exceed \p tolerance().
+   */
+  T * find(const Point & p,
+           const Real tol) const;
 
   Point point_of(const T &) const;
 
 protected:
-  unsigned int key(const Point &);
+  typedef unsigned long long key_type;
+
+  key_type key(const Point &) const;
 
   void fill(MeshBase &);
 
 private:
-  map_type          _map;
+  class Inserter;
+
+  /**
+   * One hash table entry.  A slot is claimed by setting its key; an
+   * empty slot has key 0.
+   */
+  struct Slot
+  {
+    Slot() : key(0), value(libmesh_nullptr) {}
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+    std::atomic<key_type> key;
+    std::atomic<T *> value;
+#else
+    key_type key;
+    T * value;
+#endif
+  };
+
+  /**
+   * Stores \p t under \p k.  With C++11 atomics this is safe to call
+   * concurrently as long as the table has room for every object being
+   * inserted.
+   */
+  void insert_into_slot(const key_type k, T & t);
+
+  void rehash(std::size_t capacity);
+
+  std::vector<Slot> _slots;
+  std::size_t       _size;
+  Real              _tolerance;
   std::vector<Real> _lower_bound;
   std::vector<Real> _upper_bound;
+  std::vector<Real> _n_bins;
 };
 
 } // namespace libMesh
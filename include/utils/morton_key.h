@@ -0,0 +1,67 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2016 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_MORTON_KEY_H
+#define LIBMESH_MORTON_KEY_H
+
+#include <stdint.h> // uint64_t
+
+#include "libmesh/point.h"
+
+namespace libMesh
+{
+namespace Utility
+{
+// Spreads the low 21 bits of x out to every third bit
+inline
+uint64_t spread_bits (uint64_t x)
+{
+  x &= 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffULL;
+  x = (x | x << 16) & 0x1f0000ff0000ffULL;
+  x = (x | x << 8)  & 0x100f00f00f00f00fULL;
+  x = (x | x << 4)  & 0x10c30c30c30c30c3ULL;
+  x = (x | x << 2)  & 0x1249249249249249ULL;
+  return x;
+}
+
+
+
+// The position of p along a Morton curve through the box [lower,
+// upper], with 21 bits of resolution in each direction.  Sorting
+// points by their keys keeps points which are close together in
+// space close together in memory.
+inline
+uint64_t morton_key (const Point & p,
+                     const Point & lower,
+                     const Point & upper)
+{
+  uint64_t key = 0;
+  for (unsigned int d=0; d != LIBMESH_DIM; ++d)
+    {
+      const Real width = upper(d) - lower(d);
+      const uint64_t x = (width > 0) ?
+        static_cast<uint64_t>((p(d) - lower(d)) / width * Real(0x1fffff)) : 0;
+      key |= spread_bits(x) << d;
+    }
+  return key;
+}
+
+} // end Utility namespace
+} // end libMesh namespace
+
+#endif // LIBMESH_MORTON_KEY_H
@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <iosfwd>
 #include <map>
 #include <stack>
 #include <string>
@@ -35,6 +36,9 @@
 namespace libMesh
 {
 
+// Forward declarations
+struct PerfTrace;
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -247,8 +251,58 @@ public:
    */
   PerfData get_perf_data(const std::string & label, const std::string & header="");
 
+  /**
+   * Starts recording a timeline of every event pushed and popped,
+   * with one event buffer per thread.  Unlike the summary log,
+   * tracing stays on inside threaded loops, so the timeline shows
+   * how work is spread across threads.  Tracing is independent of
+   * \p enable_logging() and \p disable_logging().  If the compiler
+   * lacks thread-local storage, events from inside threaded loops
+   * are dropped.
+   */
+  void enable_tracing();
+
+  /**
+   * Stops recording the timeline.  Events recorded so far are kept.
+   */
+  void disable_tracing() { trace_events = false; }
+
+  /**
+   * Returns true iff timeline tracing is enabled
+   */
+  bool tracing_enabled() const { return trace_events; }
+
+  /**
+   * Writes the recorded timeline as a sequence of Chrome trace event
+   * format objects, each followed by a comma.  Wrapped in a
+   * \p {"traceEvents":[...]} array, the output can be loaded into
+   * chrome://tracing or Perfetto.  The events are labelled with
+   * process id \p pid and with one thread id per recording thread.
+   * Any events still open are closed at the current time.
+   *
+   * Must not be called while other threads are recording events.
+   */
+  void print_trace_events(std::ostream & os,
+                          unsigned int pid) const;
+
+  /**
+   * Discards the recorded timeline.  Must not be called while other
+   * threads are recording events.
+   */
+  void clear_trace();
+
 private:
 
+  /**
+   * Records the beginning or end of an event in the timeline.  Only
+   * the first occurrence of an event from a given pair of strings
+   * builds any \p std::string; after that each thread finds the
+   * event id in a small cache keyed by the string addresses.
+   */
+  void trace(const char * label,
+             const char * header,
+             bool begin);
+
 
   /**
    * The label for this object.
@@ -260,6 +314,16 @@ private:
    */
   bool log_events;
 
+  /**
+   * Flag to enable timeline tracing.
+   */
+  bool trace_events;
+
+  /**
+   * The recorded timeline, or \p NULL if tracing was never enabled.
+   */
+  PerfTrace * trace_data;
+
   /**
    * The total running time for recorded events.
    */
@@ -387,6 +451,9 @@ void PerfLog::push (const std::string & label,
       perf_data->start();
       log_stack.push(perf_data);
     }
+
+  if (this->trace_events)
+    this->trace(label.c_str(), header.c_str(), true);
 }
 
 
@@ -397,13 +464,15 @@ void PerfLog::push (const char * label,
 {
   if (this->log_events)
     this->push(std::string(label), std::string(header));
+  else if (this->trace_events)
+    this->trace(label, header, true);
 }
 
 
 
 inline
-void PerfLog::pop (const std::string & libmesh_dbg_var(label),
-                   const std::string & libmesh_dbg_var(header))
+void PerfLog::pop (const std::string & label,
+                   const std::string & header)
 {
   if (this->log_events)
     {
@@ -432,6 +501,9 @@ void PerfLog::pop (const std::string & libmesh_dbg_var(label),
       if (!log_stack.empty())
         log_stack.top()->restart();
     }
+
+  if (this->trace_events)
+    this->trace(label.c_str(), header.c_str(), false);
 }
 
 
@@ -442,6 +514,8 @@ void PerfLog::pop(const char * label,
 {
   if (this->log_events)
     this->pop(std::string(label), std::string(header));
+  else if (this->trace_events)
+    this->trace(label, header, false);
 }
 
 
@@ -106,6 +106,25 @@ public:
                            std::set<const Elem *> & candidate_elements,
                            const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const = 0;
 
+  /**
+   * Locates an element containing each of the \p points and stores
+   * them in \p elems.  Points that lie in no element (in out-of-mesh
+   * mode) get a \p NULL entry.  Optionally restricts the subdomains
+   * searched.
+   *
+   * A point on a face, edge or vertex shared by several elements may
+   * be assigned any one of them, which need not be the element the
+   * single-point \p operator() returns for that point.
+   *
+   * The default implementation just calls \p operator() for each
+   * point; derived classes may answer large batches more efficiently,
+   * and may do so without modifying the locator, so that one locator
+   * can serve several threads at once.
+   */
+  virtual void locate (const std::vector<Point> & points,
+                       std::vector<const Elem *> & elems,
+                       const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const;
+
   /**
    * @returns \p true when this object is properly initialized
    * and ready for use, \p false otherwise.
@@ -0,0 +1,187 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2016 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+/**
+ * This is a point locator which searches a bounding volume hierarchy
+ * of the active elements.  Unlike the \p TreeNode based trees used
+ * by \p PointLocatorTree, the hierarchy is stored in a few contiguous
+ * arrays: the elements are sorted along a Morton curve through the
+ * mesh bounding box, and each node of the hierarchy covers a
+ * contiguous range of them, so that a search only has to follow
+ * array offsets.  The element bounding boxes and Morton codes are
+ * computed in parallel with threads.
+ *
+ * Searches do not modify the locator, so one locator can be used by
+ * several threads at once.  Use \p PointLocatorBase::build() with
+ * type \p BVH to create objects of this type at run time.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a master locator, whose hierarchy we
+   * will share rather than building our own.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = libmesh_nullptr);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.
+   */
+  virtual void clear() libmesh_override;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.
+   */
+  virtual void init() libmesh_override;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed
+   * subdomains.
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
+  /**
+   * Locates the set of elements within the close-to-point tolerance
+   * of the point with global coordinates \p p, optionally restricted
+   * to a set of allowed subdomains.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return a NULL pointer instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () libmesh_override;
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode () libmesh_override;
+
+  /**
+   * Set the largest number of elements stored in a leaf of the
+   * hierarchy.  A hierarchy which has already been built is rebuilt
+   * with the new size.
+   */
+  void set_leaf_size (unsigned int leaf_size);
+
+  /**
+   * \returns the number of nodes in the hierarchy.
+   */
+  std::size_t n_bvh_nodes () const;
+
+  /**
+   * A node of the hierarchy.  The children of an interior node are
+   * stored at \p index+1 and at \p second_child; a leaf covers
+   * \p n_elem elements starting at \p first_elem in the sorted
+   * element array.
+   */
+  struct BVHNode
+  {
+    Real lower[LIBMESH_DIM];
+    Real upper[LIBMESH_DIM];
+    dof_id_type first_elem;
+    dof_id_type second_child;
+    unsigned int n_elem;
+  };
+
+protected:
+  /**
+   * Calls \p found(elem) for each element in the allowed subdomains
+   * whose inflated bounding box contains \p p, stopping as soon as
+   * \p found returns \p true.
+   */
+  template <typename Visitor>
+  void visit_candidates (const Point & p,
+                         const std::set<subdomain_id_type> * allowed_subdomains,
+                         Visitor & found) const;
+
+  /**
+   * Builds the nodes covering the sorted elements [\p begin, \p end)
+   * and \returns the index of the subtree root.
+   */
+  dof_id_type build_subtree (dof_id_type begin,
+                             dof_id_type end,
+                             const std::vector<Real> & elem_boxes);
+
+  /**
+   * \returns the locator that owns the hierarchy we search: either
+   * ourself or our master.
+   */
+  const PointLocatorBVH & owner () const;
+
+  /**
+   * The hierarchy, root first.
+   */
+  std::vector<BVHNode> _nodes;
+
+  /**
+   * The active elements, in Morton order.
+   */
+  std::vector<const Elem *> _elems;
+
+  /**
+   * The largest number of elements in a leaf.
+   */
+  unsigned int _leaf_size;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.  See \p
+   * enable_out_of_mesh_mode() for details.
+   */
+  bool _out_of_mesh_mode;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
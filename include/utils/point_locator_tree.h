@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -115,6 +116,25 @@ public:
                            std::set<const Elem *> & candidate_elements,
                            const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
 
+  /**
+   * Locates the elements containing each of the \p points.  The
+   * points are visited in the order of a space-filling curve through
+   * their bounding box, and each search starts by walking across the
+   * neighbors of the element found for the previous point, so that
+   * only points far from their predecessor need to query the tree.
+   *
+   * Unlike the single-point \p operator(), this method does not use
+   * or update the cached element, so several threads may call it on
+   * the same locator concurrently.
+   *
+   * Which element a point on a shared face, edge or vertex is
+   * assigned to depends on the walk, and so on the other points in
+   * the batch; it may differ from the element \p operator() returns.
+   */
+  virtual void locate (const std::vector<Point> & points,
+                       std::vector<const Elem *> & elems,
+                       const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
   /**
    * As a fallback option, it's helpful to be able to do a linear
    * search over the entire mesh. This can be used if operator()
@@ -163,6 +183,31 @@ public:
   unsigned int get_target_bin_size() const;
 
 protected:
+  /**
+   * Locates the element containing \p p by asking the tree, with
+   * the linear search fallbacks of \p operator(), but without
+   * touching the cached element.
+   */
+  const Elem * find_element (const Point & p,
+                             const std::set<subdomain_id_type> * allowed_subdomains) const;
+
+  /**
+   * Walks from \p start across face neighbors toward \p p, for a
+   * few steps at most.  \returns the element containing \p p if one
+   * was reached, or \p NULL otherwise.
+   */
+  const Elem * walk_to_element (const Point & p,
+                                const Elem * start,
+                                const std::set<subdomain_id_type> * allowed_subdomains) const;
+
+  /**
+   * \returns \p true if \p elem is an element our tree could have
+   * returned: active, local if we only search local elements, and in
+   * \p allowed_subdomains if that is given.
+   */
+  bool is_searchable (const Elem * elem,
+                      const std::set<subdomain_id_type> * allowed_subdomains) const;
+
   /**
    * Pointer to our tree.  The tree is built at run-time
    * through \p init().  For servant PointLocators (not master),
@@ -14,7 +14,9 @@
   CPPUNIT_TEST( testSetNSystems );              \
   CPPUNIT_TEST( testSetNVariableGroups );       \
   CPPUNIT_TEST( testManualDofCalculation );     \
-  CPPUNIT_TEST( testJensEftangBug );
+  CPPUNIT_TEST( testJensEftangBug );            \
+  CPPUNIT_TEST( testIndexBufferSize );          \
+  CPPUNIT_TEST( testIndexBufferGrowth );
 
 using namespace libMesh;
 
@@ -185,6 +187,42 @@ public:
     CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,2,0), (dof_id_type) 193);
     CPPUNIT_ASSERT_EQUAL (aobject.dof_number(1,0,0), (dof_id_type)   1);
   }
+
+  void testIndexBufferSize()
+  {
+    // The index buffer should be no larger than the std::vector it
+    // replaced
+    CPPUNIT_ASSERT(DofObject::index_buffer_size() <=
+                   sizeof(std::vector<dof_id_type>));
+  }
+
+  void testIndexBufferGrowth()
+  {
+    DofObject aobject(*instance);
+
+    // Small enough to be stored inline
+    dof_id_type buf0[] = {1, 257, 40};
+    aobject.set_buffer(std::vector<dof_id_type>(buf0, buf0+3));
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,0,0), (dof_id_type)  40);
+
+    // Large enough to spill to the heap
+    dof_id_type buf1[] = {2, 8, 257, 1, 257, 97, 257, 193, 257, 1};
+    aobject.set_buffer(std::vector<dof_id_type>(buf1, buf1+10));
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,2,0), (dof_id_type) 193);
+
+    // Copies of heap buffers are independent of the original
+    DofObject bobject(aobject);
+    aobject.set_buffer(std::vector<dof_id_type>(buf0, buf0+3));
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,0,0), (dof_id_type)  40);
+    CPPUNIT_ASSERT_EQUAL (bobject.dof_number(0,1,0), (dof_id_type)  97);
+    CPPUNIT_ASSERT_EQUAL (bobject.dof_number(1,0,0), (dof_id_type)   1);
+
+    // Grow the inline buffer in place by adding systems
+    aobject.add_system();
+    aobject.add_system();
+    CPPUNIT_ASSERT_EQUAL (aobject.n_systems(), 3u);
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,0,0), (dof_id_type)  40);
+  }
 };
 
 #endif // #ifdef __dof_object_test_h__
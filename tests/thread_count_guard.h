@@ -0,0 +1,31 @@
+#ifndef THREAD_COUNT_GUARD_H
+#define THREAD_COUNT_GUARD_H
+
+#include <libmesh/libmesh.h>
+
+// Sets the number of threads libMesh uses, regardless of the command
+// line, for as long as the guard exists.  The previous number is
+// restored on destruction, including when an assertion throws.
+class ThreadCountGuard
+{
+public:
+  explicit ThreadCountGuard (const int n_threads) :
+    _old_n_threads(libMesh::libMeshPrivateData::_n_threads)
+  {
+    libMesh::libMeshPrivateData::_n_threads = n_threads;
+  }
+
+  ~ThreadCountGuard ()
+  {
+    libMesh::libMeshPrivateData::_n_threads = _old_n_threads;
+  }
+
+private:
+  const int _old_n_threads;
+
+  // Not copyable
+  ThreadCountGuard (const ThreadCountGuard &);
+  ThreadCountGuard & operator= (const ThreadCountGuard &);
+};
+
+#endif // THREAD_COUNT_GUARD_H